@@ -1,10 +1,10 @@
 #ifndef __APP_ABOUT_H
 #define __APP_ABOUT_H
 
-// ڽ
+// 关于界面入口
 void App_About_Loop(void);
 
-// һ¼ ()
+// 一次性烧录函数 (开发调试用)
 void About_Burn_Images(void);
 
 #endif
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include "menu_core.h"
 #include "w25qxx.h"
 
-// --- ͼƬ (¼¼ע͵ԽʡƬFlash) ---
+// --- 图片数据 (仅用于烧录，烧录完可以注释掉以节省单片机Flash) ---
 // const uint8_t namecardData[] = {
 // 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x30, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x30, 0xf0, 0x00, 0x00, 0x80, 0x00, 0x80, 0xa0, 0xc0, 0xc0, 0x00, 0x30,
 // 0x70, 0x40, 0x40, 0xb0, 0x00, 0xc0, 0xc0, 0x00, 0x40, 0xc0, 0xc0, 0x80, 0xc0, 0x40, 0x40, 0x00, 0x60, 0x60, 0xe0, 0x40, 0x00, 0xe0, 0xf0, 0x30,
@@ -54,60 +54,61 @@
 
 // };
 
-// const Image namecardImg_Flash = {60, 60, NULL}; // ָΪգʾⲿFlash
+// const Image namecardImg_Flash = {60, 60, NULL}; // 数据指针为空，表示在外部Flash
 // const Image qqImg_Flash = {63, 64, NULL};
 
-// --- ַ ---
-// 2: 16MB - 8KB = 0x1000000 - 0x2000 = 0xFFE000
+// --- 地址定义 ---
+// 倒数第2个扇区: 16MB - 8KB = 0x1000000 - 0x2000 = 0xFFE000
 #define ABOUT_SECTOR_ADDR  0x00FFE000
 #define IMG1_ADDR          (ABOUT_SECTOR_ADDR)
-#define IMG2_ADDR          (ABOUT_SECTOR_ADDR + 1024) // ƫ1KB
+#define IMG2_ADDR          (ABOUT_SECTOR_ADDR + 1024) // 偏移1KB
 
-// --- ¼ߺ ---
-//  main.c ʼһΣȻע͵
+// --- 烧录工具函数 ---
+// 请在 main.c 初始化后调用一次，然后注释掉
 // void About_Burn_Images(void) {
-//     // 1. 
+//     // 1. 擦除扇区
 //     W25Q_Erase_Sector(ABOUT_SECTOR_ADDR);
     
-//     // 2. дͼƬ1
+//     // 2. 写入图片1
 //     W25Q_Write_NoCheck((uint8_t*)namecardData, IMG1_ADDR, sizeof(namecardData));
     
-//     // 3. дͼƬ2
+//     // 3. 写入图片2
 //     W25Q_Write_NoCheck((uint8_t*)qqData, IMG2_ADDR, sizeof(qqData));
 // }
 
-// --- App ߼ ---
+// --- App 逻辑 ---
 void App_About_Loop(void) {
     static uint8_t img_index = 0; // 0:Namecard, 1:QQ
     
-    // Դ滺 (ҪFlashݴ棬ٻOLED)
-    // ͼƬ 63*64 = 504ֽڣOLED_GRAM 㹻󣬵Ҫһʱbuffer OLED_DrawImage
-    // Ǹ OLED_DrawImage ִ֧ Flash ַ
-    // ջϿһ buffer (512ֽڶ stack е󣬸Ϊ̬)
+    // 显存缓冲区 (我们需要从Flash读出来暂存，再画到OLED)
+    // 最大图片 63*64 = 504字节，OLED_GRAM 足够大，但我们需要一个临时buffer传给 OLED_DrawImage
+    // 或者我们改造 OLED_DrawImage 让它支持从 Flash 地址读？
+    // 简单起见，我们在栈上开一个 buffer (512字节对于 stack 有点大，改为静态)
     static uint8_t img_buf[512]; 
 
-    // 1. 
+    // 1. 绘制
     OLED_NewFrame();
     
     uint32_t read_addr = (img_index == 0) ? IMG1_ADDR : IMG2_ADDR;
     uint8_t w = (img_index == 0) ? 60 : 63;
     uint8_t h = (img_index == 0) ? 60 : 64;
     
-    //  Flash ȡͼƬݵ RAM
-    W25Q_Read(img_buf, read_addr, (w * (h/8) + ((h%8)?w:0))); // ֽڴС
+    // 从 Flash 读取图片数据到 RAM
+    W25Q_Read(img_buf, read_addr, (w * (h/8) + ((h%8)?w:0))); // 计算字节大小
     
-    // ʱ Image 
+    // 构建临时 Image 对象
     Image temp_img;
     temp_img.w = w;
     temp_img.h = h;
     temp_img.data = img_buf;
+    temp_img.mask = NULL;
     
-    // ʾ
+    // 居中显示
     uint8_t x = (128 - w) / 2;
     uint8_t y = (64 - h) / 2;
     OLED_DrawImage(x, y, &temp_img, OLED_COLOR_NORMAL);
     
-    // ײָʾ
+    // 底部指示器
     if (img_index == 0) {
         OLED_PrintASCIIString(0, 0, "wechat", &afont8x6, OLED_COLOR_NORMAL);
         OLED_PrintASCIIString(120, 56, ">", &afont8x6, OLED_COLOR_NORMAL);
@@ -118,14 +119,14 @@ void App_About_Loop(void) {
 
     OLED_ShowFrame();
 
-    // 2. 
-    if (Key_IsSingleClick(KEY1_ID)) { // л
+    // 2. 按键
+    if (Key_IsSingleClick(KEY1_ID)) { // 切换
         img_index = !img_index;
     }
-    if (Key_IsSingleClick(KEY3_ID)) { // л
+    if (Key_IsSingleClick(KEY3_ID)) { // 切换
         img_index = !img_index;
     }
-    if (Key_IsSingleClick(KEY2_ID)) { // ˳
+    if (Key_IsSingleClick(KEY2_ID)) { // 退出
         Menu_SwitchToMenu();
     }
 }
\ No newline at end of file
@@ -8,19 +8,16 @@
 #include <stdio.h>
 #include <string.h>
 
-//  OLED Դ (oled.c ж)
-// ע⣺Ҫ oled.h  oled.c ȷ OLED_GRAM ǿɼģ
-extern uint8_t OLED_GRAM[8][128]; 
 
 #ifndef PI
 #define PI 3.1415926535f
 #endif
 static uint8_t jump_height_offset = 0;
 
-// Game Over ꣺0=Restart, 1=Exit
+// 【新增】Game Over 弹窗光标：0=Restart, 1=Exit
 static uint8_t game_over_cursor = 0; 
 // ============================================================================
-//   Դ (ͼģ)
+//   资源数据 (图模)
 // ============================================================================
 
 const uint8_t Dino_Ground_Data[] = {
@@ -42,7 +39,7 @@ const uint8_t Dino_Ground_Data[] = {
 	0x0E,0x0E,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x4D,0x4F,0x4E,0x0E,0x0C,0x9C,0x0C,
 }; // 256 bytes scrolling ground
 
-// ϰ (16x18)
+// 障碍物数据 (16x18)
 const uint8_t Barrier_Data[3][48]={
 	//Barrier0
     {
@@ -68,21 +65,21 @@ const uint8_t Cloud_Data[]={
 	0x30,0x28,0x28,0x2C,0x26,0x23,0x21,0x21,0x21,0x21,0x23,0x22,0x22,0x2E,0x38,0x30,
 };
 
-//  (16x18)
+// 恐龙数据 (16x18)
 const uint8_t Dino_Data[3][48]={
-	//ŵ
+	//后腿着地
     {
 	0xF0,0xC0,0x00,0x00,0x00,0x80,0x80,0xC0,0xFE,0xFF,0xFB,0xFF,0x7F,0x6F,0x6F,0x0E,
     0xC3,0x07,0x0F,0xFE,0xFF,0x7F,0x1F,0x1F,0x7F,0x7F,0x5F,0x07,0xC1,0xC3,0xC0,0xC0,
     0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
     },
-	//ǰŵ
+	//前腿着地
     {
 	0xF0,0xC0,0x00,0x00,0x00,0x80,0x80,0xC0,0xFE,0xFF,0xFB,0xFF,0x7F,0x6F,0x6F,0x0E,
     0xC3,0x07,0x0F,0x7E,0x7F,0x5F,0x1F,0x1F,0xFF,0xFF,0x3F,0x07,0xC1,0xC3,0xC0,0xC0,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00
     },
-	//˫ŵ (Ծ)
+	//双腿着地 (跳跃)
     {
 	0xF0,0xC0,0x00,0x00,0x00,0x80,0x80,0xC0,0xFE,0xFF,0xFB,0xFF,0x7F,0x6F,0x6F,0x0E,
     0x03,0x07,0x0F,0xFE,0xFF,0x7F,0x1F,0x1F,0xFF,0xFF,0x7F,0x07,0x01,0x03,0x00,0x00,
@@ -90,7 +87,7 @@ const uint8_t Dino_Data[3][48]={
     }
 };
 
-// װ oled.h ж Image ṹ
+// 封装成你的 oled.h 中定义的 Image 结构体
 const Image img_cloud = {16, 8, Cloud_Data};
 const Image img_barrier[3] = {
     {16, 18, Barrier_Data[0]},
@@ -104,7 +101,7 @@ const Image img_dino[3] = {
 };
 
 // ============================================================================
-//   Ϸ߼
+//   游戏逻辑变量
 // ============================================================================
 
 typedef enum {
@@ -121,7 +118,7 @@ static DinoState_t game_state = DINO_STATE_INIT;
 static int score = 0;
 static uint16_t ground_pos = 0;
 static uint8_t barrier_type = 0;
-static uint8_t barrier_pos = 0; //  pos ָĻϵƶԭ߼еƣ
+static uint8_t barrier_pos = 0; // 这里的 pos 指的是在屏幕上的相对移动，原逻辑有点绕，我们沿用
 static uint8_t cloud_pos = 0;
 static uint8_t is_jumping = 0;
 static uint16_t jump_tick = 0;
@@ -130,12 +127,12 @@ static uint16_t jump_tick = 0;
 static Object_Pos pos_dino;
 static Object_Pos pos_barrier;
 
-// Ѷȿ
+// 难度控制
 static uint32_t last_frame_tick = 0;
 #define FRAME_INTERVAL 30 // 33ms ~ 30FPS
 
 // ============================================================================
-//   ڲʵ
+//   内部函数实现
 // ============================================================================
 
 static void Dino_InitGame(void) {
@@ -148,7 +145,7 @@ static void Dino_InitGame(void) {
     jump_height_offset = 0;
     barrier_type = 0;
     
-    game_over_cursor = 0; // ùĬؿ
+    game_over_cursor = 0; // 【新增】重置光标默认在重开上
     
     srand(HAL_GetTick());
 }
@@ -159,59 +156,41 @@ static void Show_Score(void) {
     OLED_PrintASCIIString(94, 0, buf, &afont8x6, OLED_COLOR_NORMAL);
 }
 
-// ģԴֱӲʵֵ
+// 地面滚动: 地面数据宽256高8, 位于屏幕最底部 (Page 7), 超过末尾的部分从头补齐
 static void Show_Ground(void) {
-    // ݸ߶8 (1ҳ)λĻײ (Page 7)
-    // ԭʼݳ 256
-    
-    //  ground_pos < 128ֱӸһ
-    //  ground_pos ܴҪƴһ
-    uint8_t *page7 = OLED_GRAM[7]; // ȡԴ7ҳָ
-    
-    // ģԭ߼ֱдԴ
-    if(ground_pos < 128) {
-        for(uint8_t i = 0; i < 128; i++) {
-            page7[i] |= Dino_Ground_Data[i + ground_pos]; // ʹ |= ֹǷףֱӸ
-            page7[i] = Dino_Ground_Data[i + ground_pos];
-        }
-    } else {
-        // Ҫؾ
-        // һΣ ground_pos  255
-        uint8_t part1_len = 256 - ground_pos;
-        // ֻе part1_len < 128 ʱҪؾ ground_pos >= 128 part1_len 128
-        for(uint8_t i = 0; i < part1_len; i++) {
-            page7[i] = Dino_Ground_Data[i + ground_pos];
-        }
-        // ڶΣ 0 ʼ
-        for(uint8_t i = part1_len; i < 128; i++) {
-            page7[i] = Dino_Ground_Data[i - part1_len];
-        }
-    }
+    uint16_t part1_len = 256 - ground_pos; // 从 ground_pos 到数据末尾的长度
+    if (part1_len > 128) part1_len = 128;
+
+    // 第一段：从 ground_pos 开始
+    OLED_SetBlock(0, 56, &Dino_Ground_Data[ground_pos], part1_len, 8, OLED_COLOR_NORMAL);
+    // 第二段：回卷，从 0 开始补齐 (长度为0时不绘制)
+    OLED_SetBlock(part1_len, 56, Dino_Ground_Data, 128 - part1_len, 8, OLED_COLOR_NORMAL);
 }
 
 static void Show_Barrier(void) {
-    // Barrier_Pos ԭһֵ >= 143 ʱ
-    //  X = 127 - Barrier_Pos
+    // Barrier_Pos 在原代码中是一个递增的值，当 >= 143 时重置
+    // 绘制坐标 X = 127 - Barrier_Pos
     
     int16_t draw_x = 127 - barrier_pos;
     
     if (barrier_pos >= 143) {
         barrier_type = rand() % 3;
-        barrier_pos = 0; // ϰλ
+        barrier_pos = 0; // 重置障碍物位置
         draw_x = 127;
     }
     
-    // Y  44
-    // ע⣺Barrier  16x18Խ Page 5,6,7
-    OLED_DrawImage((uint8_t)draw_x, 44, &img_barrier[barrier_type], OLED_COLOR_NORMAL);
+    // Y 坐标 44
+    // 注意：Barrier 是 16x18，跨越了 Page 5,6,7
+    // draw_x 为负数时由 OLED_DrawImage 裁掉左边露出屏幕的部分
+    OLED_DrawImageOp(draw_x, 44, &img_barrier[barrier_type], OLED_ROP_OR);
     
-    // ײ
+    // 更新碰撞箱
     pos_barrier.minX = (draw_x < 0) ? 0 : draw_x;
     pos_barrier.maxX = draw_x + 16;
     pos_barrier.minY = 44;
     pos_barrier.maxY = 62;
     
-    // ϰƳĻߣҪ maxX ̫ж(Ȼԭ߼û)
+    // 如果障碍物移出屏幕左边，不要让 maxX 太大干扰判断(虽然原逻辑没处理)
     if (draw_x < -16) { 
         pos_barrier.maxX = 0; 
         pos_barrier.minX = 0;
@@ -220,79 +199,79 @@ static void Show_Barrier(void) {
 
 static void Show_Cloud(void) {
     int16_t draw_x = 127 - cloud_pos;
-    OLED_DrawImage((uint8_t)draw_x, 9, &img_cloud, OLED_COLOR_NORMAL);
+    OLED_DrawImageOp(draw_x, 9, &img_cloud, OLED_ROP_OR);
 }
 
 static void Show_Dino(void) {
-    // Ծ
+    // 跳跃计算
     if (is_jumping) {
-        // ԭ߼Jump_Pos = 28 * sin(pi * jump_t / 1000)
-        // jump_t ÿ + 20 (Ϊԭ߼һTick1ǰʱ)
-        // Ǽһ£
-        // jump_t Χ 0 - 1000 (һԾ)
+        // 原逻辑：Jump_Pos = 28 * sin(pi * jump_t / 1000)
+        // jump_t 每次 + 20 (因为原逻辑是一次Tick加1，这里我们按时间比例)
+        // 让我们简化一下：
+        // jump_t 范围 0 - 1000 (代表一个完整跳跃周期)
         
         float rad = (float)(PI * jump_tick / 1000.0f);
         jump_height_offset = (uint8_t)(28 * sinf(rad));
         
-        // Ծͼ
-        OLED_DrawImage(0, 44 - jump_height_offset, &img_dino[2], OLED_COLOR_NORMAL);
+        // 绘制跳跃图
+        OLED_DrawImageOp(0, 44 - jump_height_offset, &img_dino[2], OLED_ROP_OR);
     } else {
-        // ܶ ( cloud_pos  ֡ л)
-        //  cloud_pos % 4 лƵ
+        // 奔跑动画 (根据 cloud_pos 或 帧数 切换腿)
+        // 简单用 cloud_pos % 4 来切换频率
         if ((cloud_pos / 4) % 2 == 0) {
-            OLED_DrawImage(0, 44, &img_dino[0], OLED_COLOR_NORMAL);
+            OLED_DrawImageOp(0, 44, &img_dino[0], OLED_ROP_OR);
         } else {
-            OLED_DrawImage(0, 44, &img_dino[1], OLED_COLOR_NORMAL);
+            OLED_DrawImageOp(0, 44, &img_dino[1], OLED_ROP_OR);
         }
     }
     
-    // ¿ײ
-    pos_dino.minX = 4; // Ȼx=0ƣеհף΢һж
+    // 更新恐龙碰撞箱
+    pos_dino.minX = 4; // 恐龙虽然在x=0绘制，但有点空白，稍微缩一下判定
     pos_dino.maxX = 12;
-    pos_dino.minY = 44 - jump_height_offset + 2; // ΢һͷ
+    pos_dino.minY = 44 - jump_height_offset + 2; // 稍微缩一下头部
     pos_dino.maxY = 62 - jump_height_offset;
 }
 
 static uint8_t Check_Collision(void) {
-    // AABB ײ
+    // AABB 碰撞检测
     if ((pos_dino.maxX > pos_barrier.minX) && 
         (pos_dino.minX < pos_barrier.maxX) && 
         (pos_dino.maxY > pos_barrier.minY) && 
         (pos_dino.minY < pos_barrier.maxY)) 
     {
-        return 1; // ײ
+        return 1; // 撞了
     }
     return 0;
 }
 
-// ߼ (ԭ Dino_Tick)
+// 物理和逻辑更新 (替代原本的 Dino_Tick)
 static void Update_Physics(void) {
-    // 1.  (ÿ5֡1)
+    // 1. 分数增加 (每5帧加1分)
     static uint8_t score_div = 0;
     if (++score_div > 5) {
         score++;
         score_div = 0;
     }
     
-    // 2. ϰƶ (ٶȿ)
-    // ÿƶ 2-3 أٶȸ
-    uint8_t speed = 3 + (score / 200); // ŷٶ
+    // 2. 地面和障碍物移动 (速度快)
+    // 每次移动 2-3 像素，增加速度感
+    uint8_t speed = 3 + (score / 200); // 随着分数增加速度
     if (speed > 6) speed = 6;
 
     ground_pos += speed;
     barrier_pos += speed;
     
     if (ground_pos >= 256) ground_pos -= 256;
-    // Barrier_pos ߼ Show_Barrier ﴦֻܼ
+    // Barrier_pos 的重置逻辑在 Show_Barrier 里处理，这里只管加
     
-    // 3. ƶƶ (ٶ)
+    // 3. 云朵移动 (速度慢)
     cloud_pos += 1;
     if (cloud_pos >= 200) cloud_pos = 0;
     
-    // 4. Ծ߼
+    // 4. 跳跃逻辑
     if (is_jumping) {
-        // ÿӵʱ䲽Ծٶ
-        // 1000ms ڣ30ms һ֡Լ 33 ֡
+        // 每次增加的时间步长决定跳跃速度
+        // 1000ms 周期，30ms 一帧，约 33 帧完成
         jump_tick += 35; 
         if (jump_tick >= 1000) {
             jump_tick = 0;
@@ -303,133 +282,127 @@ static void Update_Physics(void) {
 }
 
 // ============================================================================
-//   ѭ (Public)
+//   主循环 (Public)
 // ============================================================================
 
 void App_Dino_Loop(void) {
     
-    // 1. ʼ
+    // 1. 初始化
     if (game_state == DINO_STATE_INIT) {
         Dino_InitGame();
         game_state = DINO_STATE_PLAYING;
     }
 
-    // 2. ֡ʿ (Լ30FPS)
-    // е߼ͻͼ if ִУ֤ˢȶ˸
+    // 2. 帧率控制 (约30FPS)
+    // 所有的逻辑和绘图都必须在这个 if 里面执行，保证刷新率稳定，消除闪烁
     if (HAL_GetTick() - last_frame_tick < FRAME_INTERVAL) {
         return;
     }
     last_frame_tick = HAL_GetTick();
 
     // ==========================================
-    //           Ϸ (PLAYING)
+    //           游戏进行中 (PLAYING)
     // ==========================================
     if (game_state == DINO_STATE_PLAYING) {
         
-        // --- A. 봦 ---
-        // κΰԾ
+        // --- A. 输入处理 ---
+        // 任何按键跳跃
         if ((Key_IsSingleClick(KEY1_ID) || Key_IsSingleClick(KEY2_ID) || Key_IsSingleClick(KEY3_ID)) && !is_jumping) {
             is_jumping = 1;
             jump_tick = 0;
         }
-        // Ϸа KEY4 ͣ/˳? ֱΪ˳
+        // 游戏中按 KEY4 暂停/退出? 这里直接作为退出
         if (Key_IsSingleClick(KEY4_ID)) {
-            game_state = DINO_STATE_GAMEOVER; // ֱ˳
-            // ֱ˳
+            game_state = DINO_STATE_GAMEOVER; // 或者直接退出，看你需求
+            // 如果想直接退出：
             // game_state = DINO_STATE_INIT;
             // Menu_SwitchToMenu();
             // return;
         }
 
-        // --- B.  ---
+        // --- B. 物理计算 ---
         Update_Physics();
         if (Check_Collision()) {
             game_state = DINO_STATE_GAMEOVER;
-            game_over_cursor = 0; // Ĭѡؿ
+            game_over_cursor = 0; // 默认选中重开
         }
 
-        // --- C. Ⱦ ---
+        // --- C. 画面渲染 ---
         OLED_NewFrame();
         Show_Ground();
         Show_Cloud();
         Show_Barrier();
         Show_Dino();
         Show_Score();
-        OLED_ShowFrame();
+        OLED_ShowFrameAsync();
     }
     
     // ==========================================
-    //           Ϸ (GAMEOVER) - 
+    //           游戏结束 (GAMEOVER) - 弹窗处理
     // ==========================================
     else if (game_state == DINO_STATE_GAMEOVER) {
         
-        // --- A. 봦 () ---
+        // --- A. 输入处理 (弹窗交互) ---
         
-        // KEY1 (/): ѡ "Restart"
+        // KEY1 (左/上): 选择 "Restart"
         if (Key_IsSingleClick(KEY1_ID)) {
             if (game_over_cursor > 0) game_over_cursor--;
-            else game_over_cursor = 1; // ѭ
+            else game_over_cursor = 1; // 循环
         }
         
-        // KEY3 (/): ѡ "Exit"
+        // KEY3 (右/下): 选择 "Exit"
         if (Key_IsSingleClick(KEY3_ID)) {
             if (game_over_cursor < 1) game_over_cursor++;
-            else game_over_cursor = 0; // ѭ
+            else game_over_cursor = 0; // 循环
         }
 
-        // KEY2 (OK): ִѡ
+        // KEY2 (OK): 执行选择
         if (Key_IsSingleClick(KEY2_ID)) {
             if (game_over_cursor == 0) {
-                // ѡ Restart
+                // 选中了 Restart
                 Dino_InitGame();
                 game_state = DINO_STATE_PLAYING;
             } else {
-                // ѡ Exit
-                game_state = DINO_STATE_INIT; // ״̬
-                Menu_SwitchToMenu();          // ˵
+                // 选中了 Exit
+                game_state = DINO_STATE_INIT; // 重置状态
+                Menu_SwitchToMenu();          // 返回主菜单
                 return;
             }
         }
 
-        // --- B. Ⱦ ---
+        // --- B. 画面渲染 ---
         OLED_NewFrame();
         
-        // 1. Ʊ (һ֡Ϸ棬)
+        // 1. 绘制背景 (最后一帧的游戏画面，让它定格)
         Show_Ground();
         Show_Cloud();
         Show_Barrier(); 
         Show_Dino();
         Show_Score();
 
-        // 2. ư͸ɰЧ (ѡϡ󸲸ǣ򵥻)
-        // Ƶ߿ (: W=100, H=40 -> X=14, Y=12)
-        OLED_DrawFilledRectangle(14, 12, 100, 40, OLED_COLOR_REVERSED); // ׵
-        OLED_DrawRectangle(14, 12, 100, 40, OLED_COLOR_NORMAL);         // ڱ߿
+        // 2. 绘制半透明蒙版效果 (可选：用稀疏点阵覆盖，这里简单画个框)
+        // 绘制弹窗边框 (居中: W=100, H=40 -> X=14, Y=12)
+        OLED_DrawFilledRectangle(14, 12, 100, 40, OLED_COLOR_REVERSED); // 白底
+        OLED_DrawRectangle(14, 12, 100, 40, OLED_COLOR_NORMAL);         // 黑边框
         
-        // 3. 
+        // 3. 标题
         OLED_PrintASCIIString(38, 16, "GAME OVER", &afont12x6, OLED_COLOR_NORMAL);
 
-        // 4. ѡ
-        // Option 1: Restart ()
+        // 4. 绘制选项
+        // Option 1: Restart (左)
+        OLED_PrintASCIIString(20, 34, "Restart", &afont8x6, OLED_COLOR_NORMAL);
         if (game_over_cursor == 0) {
-            // ѡ״̬ڵװ (ʵĿ÷ɫ)
-            OLED_DrawFilledRectangle(18, 32, 44, 12, OLED_COLOR_NORMAL);
-            OLED_PrintASCIIString(20, 34, "Restart", &afont8x6, OLED_COLOR_REVERSED);
-        } else {
-            // δѡУ׵׺
-            OLED_PrintASCIIString(20, 34, "Restart", &afont8x6, OLED_COLOR_NORMAL);
+            // 选中状态：整块取反
+            OLED_InvertArea(18, 32, 45, 12);
         }
 
-        // Option 2: Exit ()
+        // Option 2: Exit (右)
+        OLED_PrintASCIIString(78, 34, "Exit", &afont8x6, OLED_COLOR_NORMAL);
         if (game_over_cursor == 1) {
-            // ѡ״̬
-            OLED_DrawFilledRectangle(76, 32, 28, 12, OLED_COLOR_NORMAL);
-            OLED_PrintASCIIString(78, 34, "Exit", &afont8x6, OLED_COLOR_REVERSED);
-        } else {
-            // δѡ
-            OLED_PrintASCIIString(78, 34, "Exit", &afont8x6, OLED_COLOR_NORMAL);
+            // 选中状态
+            OLED_InvertArea(76, 32, 29, 12);
         }
         
-        OLED_ShowFrame();
+        OLED_ShowFrameAsync();
     }
 }
\ No newline at end of file
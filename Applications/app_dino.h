@@ -1,7 +1,7 @@
 #ifndef __APP_DINO_H
 #define __APP_DINO_H
 
-// Ϸں
+// 恐龙游戏入口函数
 void App_Dino_Loop(void);
 
 #endif
\ No newline at end of file
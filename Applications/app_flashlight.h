@@ -1,7 +1,7 @@
 #ifndef __APP_FLASHLIGHT_H
 #define __APP_FLASHLIGHT_H
 
-// ֵͲӦں
+// 手电筒应用入口函数
 void App_FlashlightLoop(void);
 
 #endif
\ No newline at end of file
@@ -4,42 +4,70 @@
 #include "key.h"
 #include "menu_core.h"
 #include "mpu6050.h"
-#include <math.h> // Ҫõ sqrt
+#include <math.h> // 需要用到 sqrt
 
-// ---  ---
-#define CENTER_X        64  // Ļ X
-#define CENTER_Y        32  // Ļ Y
-#define BIG_RADIUS      28  // Բ뾶 (Ļ߶32߾)
-#define BUBBLE_RADIUS   5   // (СԲ)뾶
-#define MAX_MOVE_DIST   (BIG_RADIUS - BUBBLE_RADIUS - 2) // ƶ(2px϶)
+// --- 参数配置 ---
+#define CENTER_X        64  // 屏幕中心 X
+#define CENTER_Y        32  // 屏幕中心 Y
+#define BIG_RADIUS      28  // 外圆半径 (屏幕高度32，留点边距)
+#define BUBBLE_RADIUS   5   // 气泡(小圆)半径
+#define MAX_MOVE_DIST   (BIG_RADIUS - BUBBLE_RADIUS - 2) // 气泡最大移动距离(留2px缝隙)
 
-// ϵֵԽСƶԽ (1.0ʾ 1ȶӦ1)
-// ֵָ
+// 灵敏度系数：值越小，气泡移动越灵敏 (1.0表示 1度对应1像素)
+// 调整这个值来适配手感
 #define SENSITIVITY     1.0f 
 
+// --- 静态背景 (外圆 + 十字准星) ---
+// 只在第一次进入时画一次, 之后每帧直接贴图
+#define BG_W            (BIG_RADIUS * 2 + 1)
+#define BG_X            (CENTER_X - BIG_RADIUS)
+static uint8_t bg_buf[OLED_CANVAS_SIZE(BG_W, 64)];
+static Canvas bg_canvas = {BG_W, 64, bg_buf};
+static uint8_t bg_ready = 0;
+
+static void Draw_Background(void)
+{
+    uint8_t cx = CENTER_X - BG_X; // 画布内的圆心横坐标
+
+    OLED_ClearCanvas(&bg_canvas);
+    OLED_SetTarget(&bg_canvas);
+
+    // A. 画外圆 (空心)
+    OLED_DrawCircle(cx, CENTER_Y, BIG_RADIUS, OLED_COLOR_NORMAL);
+
+    // B. 画十字准星 (中心标记)
+    // 横线
+    OLED_DrawLine(cx - 4, CENTER_Y, cx + 4, CENTER_Y, OLED_COLOR_NORMAL);
+    // 竖线
+    OLED_DrawLine(cx, CENTER_Y - 4, cx, CENTER_Y + 4, OLED_COLOR_NORMAL);
+
+    OLED_SetTarget(NULL);
+    bg_ready = 1;
+}
+
 void App_Gradienter_Loop(void)
 {
-    // 1. ˳߼
-    if (Key_IsSingleClick(KEY1_ID) || Key_IsSingleClick(KEY2_ID) || Key_IsSingleClick(KEY3_ID))  // ȷϼ˳
+    // 1. 处理退出逻辑
+    if (Key_IsSingleClick(KEY1_ID) || Key_IsSingleClick(KEY2_ID) || Key_IsSingleClick(KEY3_ID))  // 按确认键退出
     {
         Menu_SwitchToMenu();
         return;
     }
 
-    // 2. ȡ̬ (ʹеĿ˲)
+    // 2. 获取姿态数据 (使用你现有的卡尔曼滤波数据)
     const MPU6050_t* mpu = MPU6050_GetDataPtr();
     
-    // 3. ƫ
-    // ʵʰװ򣬿Ҫ޸
-    // 裺RollӦXƫƣPitchӦYƫ
+    // 3. 计算偏移量
+    // 根据实际安装方向，可能需要修改正负号
+    // 假设：Roll对应X轴偏移，Pitch对应Y轴偏移
     float offset_x = -(mpu->KalmanAngleX * SENSITIVITY); 
     float offset_y = (mpu->KalmanAngleY * SENSITIVITY);
 
-    // 4. ߽㷨 (ֹܳԲȦ)
-    // 㵱ǰĵľ
+    // 4. 边界限制算法 (防止气泡跑出圆圈)
+    // 计算当前距离中心的距离
     float dist = sqrtf(offset_x * offset_x + offset_y * offset_y);
     
-    // 볬뾶еȱ
+    // 如果距离超过了允许的最大半径，进行等比例缩放
     if (dist > MAX_MOVE_DIST)
     {
         float scale = MAX_MOVE_DIST / dist;
@@ -47,28 +75,23 @@ void App_Gradienter_Loop(void)
         offset_y *= scale;
     }
 
-    // 5. Ļ
+    // 5. 计算最终屏幕坐标
     uint8_t bubble_x = (uint8_t)(CENTER_X + offset_x);
     uint8_t bubble_y = (uint8_t)(CENTER_Y + offset_y);
 
-    // 6. ƽ
+    // 6. 绘制界面
     OLED_NewFrame();
 
-    // A. Բ ()
-    OLED_DrawCircle(CENTER_X, CENTER_Y, BIG_RADIUS, OLED_COLOR_NORMAL);
-    
-    // B. ʮ׼ (ı)
-    // 
-    OLED_DrawLine(CENTER_X - 4, CENTER_Y, CENTER_X + 4, CENTER_Y, OLED_COLOR_NORMAL);
-    // 
-    OLED_DrawLine(CENTER_X, CENTER_Y - 4, CENTER_X, CENTER_Y + 4, OLED_COLOR_NORMAL);
-
-    // C.  (ʵ)
-    // Բ
+    // A/B. 外圆和十字准星 (预渲染的背景, 页对齐直接复制)
+    if (!bg_ready) Draw_Background();
+    OLED_DrawCanvas(BG_X, 0, &bg_canvas, OLED_ROP_COPY);
+
+    // C. 画气泡 (实心)
+    // 这里的坐标是气泡圆心
     OLED_DrawFilledCircle(bubble_x, bubble_y, BUBBLE_RADIUS, OLED_COLOR_NORMAL);
 
-    // D. (ѡ) ڽʾֵ
-    // ý漫򣬿԰⼸ע͵
+    // D. (可选) 在角落显示数值
+    // 如果想让界面极简，可以把下面这几行注释掉
     /*
     char buf[10];
     sprintf(buf, "R:%.0f", mpu->KalmanAngleX);
@@ -77,5 +100,5 @@ void App_Gradienter_Loop(void)
     OLED_PrintASCIIString(0, 56, buf, &afont8x6, OLED_COLOR_NORMAL);
     */
 
-    OLED_ShowFrame();
+    OLED_ShowFrameAsync();
 }
\ No newline at end of file
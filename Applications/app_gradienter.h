@@ -3,7 +3,7 @@
 
 #include <stdint.h>
 
-// ˮƽӦں
+// 水平仪应用入口函数
 void App_Gradienter_Loop(void);
 
 #endif
\ No newline at end of file
@@ -4,117 +4,122 @@
 #include "key.h"
 #include "menu_core.h"
 #include "w25qxx.h"
-#include <string.h> // Ҫ memset, strlen
+#include "glyph_cache.h"
+#include "crc32.h"
+#include <string.h> // 需要 memset, strlen
 
 // ============================================================================
-//   
+//   配置区域
 // ============================================================================
-// 3ַ: 16MB - 12KB = 0x1000000 - 0x3000
+// 倒数第3个扇区地址: 16MB - 12KB = 0x1000000 - 0x3000
 #define MANUAL_FLASH_ADDR   0x00FFD000 
-#define BYTES_PER_LINE      32  // ÿԤ32ֽ (Ļһʾ16ֽݣ)
+#define BYTES_PER_LINE      32  // 每行预留32字节 (屏幕一行最多显示16字节内容，留余量)
+// 结束行: 第0字节为0, 第1~3字节为"CRC", 第4~7字节为前面所有行的CRC32 (小端)
+// 旧版本烧录的结束行全为0, 没有CRC, 不校验
+#define MANUAL_CRC_TAG      "CRC"
 
 // ============================================================================
-//   ¼ (¼ɺ󣬿Խ·ע͵ԽʡƬ Flash)
+//   【烧录区域】 (烧录完成后，可以将下方数组注释掉以节省单片机 Flash)
 // ============================================================================
-// Ѿ¼ˣԽ #define ENABLE_BURN_CODE ע͵
+// 如果你已经烧录过了，可以将下面的 #define ENABLE_BURN_CODE 注释掉
 // #define ENABLE_BURN_CODE 
 
 #ifdef ENABLE_BURN_CODE
 static const char *raw_text_data[] = {
-    "ʹ˵顿",
+    "【使用说明书】",
     " ",
-    "1. Ʒ",
-    "лѡHJH",
-    "ֱ",
-    "豸F103",
-    "оƬ",
-    "˶ʵ",
-    "",
-    "ּṩµ",
-    "Ƕʽ",
+    "1. 产品简介",
+    "感谢您选择HJH",
+    "开发的智能手表",
+    "本设备基于F103",
+    "高性能芯片打造",
+    "集成了多项实用",
+    "功能与娱乐组件",
+    "旨在提供极致的",
+    "嵌入式交互体验",
     " ",
-    "2. Ӳ",
-    "أf103c8t6",
-    "Ļ1.3' OLED",
-    "洢16M Flash",
-    "̬MPU6050",
-    "ƵYX5200",
-    "أ250mAh",
+    "2. 硬件配置",
+    "主控：f103c8t6",
+    "屏幕：1.3' OLED",
+    "存储：16M Flash",
+    "姿态：MPU6050",
+    "音频：YX5200",
+    "电池：250mAh",
     " ",
-    "3. ߼",
-    "[]",
-    "KEY1(/)",
-    "  ˵",
-    "  С",
-    "  ıϻ",
+    "3. 交互逻辑",
+    "[基础操作]",
+    "KEY1(上/左)：",
+    "  菜单上移",
+    "  音量减小",
+    "  文本上滑",
     " ",
-    "KEY3(/)",
-    "  ˵",
-    "  ",
-    "  ı»",
+    "KEY3(下/右)：",
+    "  菜单下移",
+    "  音量增加",
+    "  文本下滑",
     " ",
-    "KEY2(ȷ)",
-    "  ˵",
-    "  ȷѡ",
-    "  ͣ/",
-    "  5ػ",
+    "KEY2(确认)：",
+    "  进入菜单",
+    "  确认选项",
+    "  暂停/播放",
+    "  长按5秒关机",
     " ",
-    "KEY4()",
-    "  ̰",
-    "  ",
+    "KEY4(开机)：",
+    "  短按开机",
+    "  弹出音量调节",
     " ",
-    "4. ",
-    "[л]",
-    "̬",
-    "̧Զ",
-    "ԶϢ",
-    "ƽžֹ",
+    "4. 功能详解",
+    "[体感唤醒]",
+    "内置姿态解算",
+    "抬腕自动亮屏",
+    "放下自动息屏",
+    "平放静止休眠",
     " ",
-    "[ֲ]",
-    "֧TFȡ",
-    "߱",
-    "߱",
-    "ֹ󴥲",
+    "[音乐播放]",
+    "支持TF卡读取",
+    "高保真解码",
+    "具备静音锁死",
+    "防止误触播放",
     " ",
-    "[ϵͳ]",
-    "֧ȵ",
-    "Ϣʱ趨",
-    "Ӷʱ",
-    "籣",
+    "[系统设置]",
+    "支持亮度调节",
+    "息屏时间设定",
+    "闹钟定时设置",
+    "参数掉电保存",
     " ",
-    "[ʵù]",
-    "ֵͲ",
-    "ˮƽ",
-    "ȷʱ",
+    "[实用工具]",
+    "高亮手电筒",
+    "六轴水平仪",
+    "精确秒表计时",
     " ",
-    "[Ϸ]",
-    "ֲȸ",
-    "䷽Ϸ",
-    "60֡",
+    "[游戏娱乐]",
+    "移植谷歌恐龙",
+    "经典方块游戏",
+    "60帧流畅运行",
     " ",
-    "5. ע",
-    " ˮ",
-    "   ԶˮԴ",
-    " 5V",
-    "   Ͻѹ",
-    " ϵͳ",
-    "   밴λ",
+    "5. 注意事项",
+    "① 本机不防水",
+    "   请远离水源",
+    "② 请用5V充电",
+    "   严禁高压",
+    "③ 若系统死机",
+    "   请按复位键",
     " ",
-    "6. ˵",
-    "Ƕʽ֮·",
-    "սȤ",
-    "ҵʫƪ",
-    "ӲҵĻ",
-    "ϣСƷ",
-    "ܴ",
+    "6. 开发者说",
+    "嵌入式开发之路",
+    "充满了挑战乐趣",
+    "代码是我的诗篇",
+    "硬件是我的画笔",
+    "希望这个小作品",
+    "能带给你启发",
     " ",
-    "汾V3.0 Final",
-    "ڣ2025-12",
-    "ߣHJH",
+    "版本：V3.0 Final",
+    "日期：2025-12",
+    "作者：HJH",
     "Design For You",
     " ",
-    "~~  ~~",
-    NULL // ־
+    "~~ 到底了 ~~",
+    NULL // 结束标志
 };
 
 
@@ -122,37 +127,42 @@ void Message_Burn_Text(void) {
     uint16_t i = 0;
     uint8_t buffer[BYTES_PER_LINE];
     uint32_t write_addr = MANUAL_FLASH_ADDR;
+    uint32_t crc = 0;
 
-    // 1.  (4KB㹻 4096/32 = 128)
-    // ˵鳬128УҪ
+    // 1. 擦除扇区 (4KB，足够存 4096/32 = 128行)
+    // 如果你的说明书超过128行，需要擦除连续的两个扇区
     W25Q_Erase_Sector(MANUAL_FLASH_ADDR);
     
-    // 2. ѭд
+    // 2. 循环写入
     while (raw_text_data[i] != NULL) {
-        //  buffer
+        // 清空 buffer
         memset(buffer, 0, BYTES_PER_LINE);
-        // ַ buffer (ֹ)
+        // 复制字符串到 buffer (防止溢出)
         strncpy((char*)buffer, raw_text_data[i], BYTES_PER_LINE - 1);
+        // CRC按要写入的内容计算, 不从Flash读回 (否则写错的数据也会被算进CRC, 阅读时校验不出来)
+        crc = Crc32_Update(crc, buffer, BYTES_PER_LINE);
         
-        // д Flash
+        // 写入 Flash
         W25Q_Write_NoCheck(buffer, write_addr, BYTES_PER_LINE);
         
-        // ַƫ
+        // 地址偏移
         write_addr += BYTES_PER_LINE;
         i++;
     }
     
-    // 3. д (дһַض)
+    // 3. 写入结束标记 (写入一个空字符串或者特定标记), 附带前面所有行的CRC32
     memset(buffer, 0, BYTES_PER_LINE);
+    memcpy(buffer + 1, MANUAL_CRC_TAG, 3);
+    memcpy(buffer + 4, &crc, 4);
     W25Q_Write_NoCheck(buffer, write_addr, BYTES_PER_LINE);
 }
 #else
-// ע˺꣬һպֹ뱨
+// 如果注释了宏，保留一个空函数防止编译报错
 void Message_Burn_Text(void) {}
 #endif
 
 // ============================================================================
-//   Ķ߼ ( Flash ȡ)
+//   阅读器逻辑 (从 Flash 读取)
 // ============================================================================
 
 #define LINE_H      16  
@@ -160,65 +170,81 @@ void Message_Burn_Text(void) {}
 
 static uint16_t scroll_line = 0; 
 static uint16_t total_lines = 0; 
+static uint8_t  manual_bad = 0;  // 说明书的CRC不一致
 
-//  Flash ı
+// 辅助函数：计算 Flash 里的文本总行数, 同时校验CRC
+// (逐行顺序读取, 读缓存会把后面的行预读进来)
 static void Count_Total_Lines(void) {
-    uint8_t buf[2]; // ֻǰֽжǷΪ
+    uint8_t buf[BYTES_PER_LINE];
+    uint32_t crc = 0;
     total_lines = 0;
+    manual_bad = 0;
     uint32_t addr = MANUAL_FLASH_ADDR;
     
     while (1) {
-        W25Q_Read(buf, addr, 2);
-        //  0x00 ()  0xFF (հFlash)ֹͣ
+        W25Q_Read(buf, addr, BYTES_PER_LINE);
+        // 如果读到 0x00 (结束符) 或 0xFF (空白Flash)，则停止
         if (buf[0] == 0x00 || buf[0] == 0xFF) {
             break;
         }
+        crc = Crc32_Update(crc, buf, BYTES_PER_LINE);
         total_lines++;
         addr += BYTES_PER_LINE;
         
-        // ȫƣֹѭ (200)
+        // 安全限制：防止死循环 (假设最大200行)
         if (total_lines > 200) break;
     }
+    
+    // 结束行中有CRC时校验
+    if (buf[0] == 0x00 && memcmp(buf + 1, MANUAL_CRC_TAG, 3) == 0) {
+        uint32_t stored;
+        memcpy(&stored, buf + 4, 4);
+        manual_bad = (stored != crc);
+    }
 }
 
 void App_Message_Loop(void) {
-    // 1. ʼ (һ)
+    // 1. 初始化：计算总行数 (仅第一次)
     if (total_lines == 0) {
         Count_Total_Lines();
     }
 
-    // 2. ƽ
+    // 2. 绘制界面
     OLED_NewFrame();
     
-    // 
+    // 标题栏
     OLED_DrawFilledRectangle(0, 0, 128, 16, OLED_COLOR_NORMAL);
     OLED_PrintASCIIString(2, 2, "<<", &afont8x6, OLED_COLOR_REVERSED);
-    OLED_PrintASCIIString(32, 2, "User Manual", &afont12x6, OLED_COLOR_REVERSED);
+    OLED_PrintASCIIString(32, 2, manual_bad ? "CRC Error" : "User Manual", &afont12x6, OLED_COLOR_REVERSED);
     
-    // 
+    // 内容区
     uint8_t start_y = 16;
-    // ʱڴ Flash ȡһı
-    char line_buf[BYTES_PER_LINE + 1]; 
+    // 临时缓冲区，用于从 Flash 读取可见的几行文本
+    char line_buf[VISIBLE_ROWS][BYTES_PER_LINE + 1]; 
+    uint8_t rows = VISIBLE_ROWS;
+    if (scroll_line + rows > total_lines) rows = total_lines - scroll_line;
     
-    for (int i = 0; i < VISIBLE_ROWS; i++) {
-        uint16_t current_idx = scroll_line + i;
-        
-        if (current_idx >= total_lines) break;
-        
-        //  Flash ַ
-        uint32_t read_addr = MANUAL_FLASH_ADDR + (current_idx * BYTES_PER_LINE);
-        
-        // ġ Flash ȡı
-        W25Q_Read((uint8_t*)line_buf, read_addr, BYTES_PER_LINE);
-        line_buf[BYTES_PER_LINE] = '\0'; // ȷַ
-        
+    // 【核心】从 Flash 读取文本 (经过读缓存, 画面不动时不用重新从 Flash 读)
+    uint32_t read_addr = MANUAL_FLASH_ADDR + (scroll_line * BYTES_PER_LINE);
+    for (int i = 0; i < rows; i++) {
+        W25Q_Read((uint8_t*)line_buf[i], read_addr + i * BYTES_PER_LINE, BYTES_PER_LINE);
+        line_buf[i][BYTES_PER_LINE] = '\0'; // 确保字符串结束符
+    }
+    
+    // 先登记所有行要用的汉字, 第一行显示时一起从 Flash 取齐
+    GlyphCache_BatchBegin();
+    for (int i = 0; i < rows; i++) {
+        OLED_PrefetchGBK(line_buf[i], 16);
+    }
+    for (int i = 0; i < rows; i++) {
         uint8_t y = start_y + i * LINE_H;
         
-        // ʾ (line_buf Ӧ GBK )
-        OLED_ShowGBK(0, y, line_buf, 16, OLED_COLOR_NORMAL);
+        // 显示 (line_buf 里的内容应该是 GBK 编码)
+        OLED_ShowGBK(0, y, line_buf[i], 16, OLED_COLOR_NORMAL);
     }
+    GlyphCache_BatchEnd();
 
-    // 
+    // 滚动条
     if (total_lines > VISIBLE_ROWS) {
         OLED_DrawLine(127, 16, 127, 63, OLED_COLOR_NORMAL);
         uint8_t bar_h = 48 * VISIBLE_ROWS / total_lines;
@@ -228,9 +254,9 @@ void App_Message_Loop(void) {
         OLED_DrawFilledRectangle(125, bar_y, 3, bar_h, OLED_COLOR_NORMAL);
     }
 
-    OLED_ShowFrame();
+    OLED_ShowFrameAsync();
 
-    // 3. 
+    // 3. 按键处理
     if (Key_IsSingleClick(KEY3_ID)) { // UP
         if (scroll_line > 0) scroll_line--;
     }
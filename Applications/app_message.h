@@ -1,10 +1,10 @@
 #ifndef __APP_MESSAGE_H
 #define __APP_MESSAGE_H
 
-// ˵Ӧ
+// 说明书应用入口
 void App_Message_Loop(void);
 
-// ˵ı¼ (ʱһ)
+// 【新增】说明书文本烧录函数 (仅开发时调用一次)
 void Message_Burn_Text(void);
 
 #endif
\ No newline at end of file
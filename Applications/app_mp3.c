@@ -3,11 +3,11 @@
 #include "oled.h"
 #include "key.h"
 #include "menu_core.h"
-#include "mp3_player.h" // ͷļ
+#include "mp3_player.h" // 包含你的驱动头文件
 #include <stdio.h>
 
 // ====================================================================
-// 1. ͼƬԴ (ʹṩģ)
+// 1. 图片资源 (使用你提供的字模)
 // ====================================================================
 const uint8_t pauseData[] = {
 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 
@@ -37,14 +37,14 @@ const uint8_t playData[] = {
 const Image playImg = {17, 18, playData};
 
 // ====================================================================
-// 2. 붨
+// 2. 变量与定义
 // ====================================================================
 
-// 
+// 布局坐标
 #define ICON_Y_POS      44  
 #define ICON_GAP        32  
 
-// ö
+// 光标枚举
 enum {
     CURSOR_BACK = 0,
     CURSOR_PREV,
@@ -52,62 +52,62 @@ enum {
     CURSOR_NEXT
 };
 
-// ״̬
+// 状态变量
 static uint8_t  cursor = CURSOR_PLAY;
-static uint8_t  current_vol = 3;     // Ĭ
-static uint8_t  is_vol_mode = 0;      // 0:ģʽ, 1:ģʽ
-static uint16_t local_track_idx = 1;  // ʾĿ
-static uint8_t  is_app_inited = 0;    // ʼ־
+static uint8_t  current_vol = 3;     // 默认音量
+static uint8_t  is_vol_mode = 0;      // 0:控制模式, 1:音量模式
+static uint16_t local_track_idx = 1;  // 本地显示的曲目号
+static uint8_t  is_app_inited = 0;    // 初始化标志
 
-//  mp3_player.c ȫֱ
+// 引用 mp3_player.c 的全局变量
 extern uint16_t MP3_TotalTracks; 
 
 // ====================================================================
-// 3. Ӧóѭ
+// 3. 应用程序主循环
 // ====================================================================
 void App_MP3_Loop(void) {
-    // --- Step 0: Ӧ״ʱǿƴӵһ׿ʼ ---
+    // --- Step 0: 应用首次运行时，强制从第一首开始 ---
     if (!is_app_inited) {
         
-        // 1. ߼״̬λ
-        local_track_idx = 1; // ǿƽʾĿΪ1
-        cursor = CURSOR_PLAY;  // 긴λŰť
+        // 1. 【核心逻辑】软件状态复位
+        local_track_idx = 1; // 强制将本地显示的曲目号设置为1
+        cursor = CURSOR_PLAY;  // 光标复位到播放按钮
         
-        // 2. ߼Ӳ״̬λ
-        MP3_PlayTrack(local_track_idx); // ǿӲŵһ׸
+        // 2. 【核心逻辑】硬件状态复位
+        MP3_PlayTrack(local_track_idx); // 强制命令硬件播放第一首歌
         HAL_Delay(10);
-        MP3_SetVolume(current_vol);     // óʼ
+        MP3_SetVolume(current_vol);     // 设置初始音量
         
-        // 3. ǳʼ
+        // 3. 标记初始化完成
         is_app_inited = 1; 
     }
 
-    // --- Step 1: ߼ ---
+    // --- Step 1: 按键逻辑 ---
     
-    // [ģʽA: ]
+    // [模式A: 音量调节]
     if (is_vol_mode) {
-        if (Key_IsSingleClick(KEY3_ID)) { // 
+        if (Key_IsSingleClick(KEY3_ID)) { // 增加音量
             if (current_vol <= 27) current_vol += 3;
             else current_vol = 30;
             MP3_SetVolume(current_vol);
         }
-        if (Key_IsSingleClick(KEY1_ID)) { // С
+        if (Key_IsSingleClick(KEY1_ID)) { // 减小音量
             if (current_vol >= 3) current_vol -= 3;
             else current_vol = 0;
             MP3_SetVolume(current_vol);
         }
-        if (Key_IsSingleClick(KEY2_ID)) { // ˳ģʽ
+        if (Key_IsSingleClick(KEY2_ID)) { // 退出音量模式
             is_vol_mode = 0; 
         }
     }
-    // [ģʽB: ſ]
+    // [模式B: 播放控制]
     else {
-        // KEY4: 
+        // KEY4: 进入音量设置
         if (Key_IsSingleClick(KEY4_ID)) {
             is_vol_mode = 1;
         }
 
-        // ƶ
+        // 光标移动
         if (Key_IsSingleClick(KEY1_ID)) { 
             if (cursor > 0) cursor--; else cursor = CURSOR_NEXT;
         }
@@ -115,33 +115,33 @@ void App_MP3_Loop(void) {
             if (cursor < CURSOR_NEXT) cursor++; else cursor = CURSOR_BACK;
         }
 
-        // ȷϲ
+        // 确认操作
         if (Key_IsSingleClick(KEY2_ID)) {
             switch (cursor) {
                 case CURSOR_BACK:
-                    is_app_inited = 0; // ־´νͬ
+                    is_app_inited = 0; // 清除标志，下次进来重新同步
                     MP3_Stop(); 
-                    // ޸ġ
-                    // ʹ Menu_NavigateBack()ΪֻԲ˵ҳЧ
-                    // APPֱлز˵ģʽ
+                    // 【核心修改】
+                    // 不再使用 Menu_NavigateBack()，因为它只对菜单页有效
+                    // 对于APP，直接切换回菜单模式即可
                     Menu_SwitchToMenu(); 
                     
-                    return; // ˳ APP ѭ
+                    return; // 立即退出 APP 循环
                 
                 case CURSOR_PREV:
-                    MP3_Prev(); // ýӿڣһ
-                    // ΪUI֣ȴѯ
+                    MP3_Prev(); // 调用接口：上一曲
+                    // 为了UI流畅，本地立即更新数字，不等待查询
                     if (local_track_idx > 1) local_track_idx--;
                     else if (MP3_TotalTracks > 0) local_track_idx = MP3_TotalTracks;
                     break;
 
                 case CURSOR_PLAY:
-                    MP3_TogglePlayback(); // ýӿڣ/ͣ
+                    MP3_TogglePlayback(); // 调用接口：播放/暂停
                     break;
 
                 case CURSOR_NEXT:
-                    MP3_Next(); // ýӿڣһ
-                    // ظ
+                    MP3_Next(); // 调用接口：下一曲
+                    // 本地更新数字
                     if (MP3_TotalTracks > 0 && local_track_idx < MP3_TotalTracks) local_track_idx++;
                     else local_track_idx = 1;
                     break;
@@ -149,10 +149,10 @@ void App_MP3_Loop(void) {
         }
     }
 
-    // --- Step 2:  ---
+    // --- Step 2: 界面绘制 ---
     OLED_NewFrame();
 
-    // A. ذť
+    // A. 顶部返回按钮
     if (cursor == CURSOR_BACK) {
         OLED_DrawFilledRectangle(0, 0, 14, 10, OLED_COLOR_NORMAL);
         OLED_PrintASCIIString(1, 1, "<<", &afont12x6, OLED_COLOR_REVERSED);
@@ -160,28 +160,28 @@ void App_MP3_Loop(void) {
         OLED_PrintASCIIString(1, 1, "<<", &afont12x6, OLED_COLOR_NORMAL);
     }
 
-    // B. Ͻʾ: ǰ/
-    // ֱʹ MP3_TotalTracks ȫֱ
+    // B. 左上角显示: 当前/总数
+    // 直接使用 MP3_TotalTracks 全局变量
     char buf[20];
     sprintf(buf, "%03d / %03d", local_track_idx, MP3_TotalTracks);
     OLED_PrintASCIIString(20, 0, buf, &afont8x6, OLED_COLOR_NORMAL);
 
-    // C. Ļм: ǰ()
+    // C. 屏幕中间: 当前歌曲编号(大字)
     sprintf(buf, "%03d", local_track_idx);
-    // м: 128 - 3*12 = 92, 92/2 = 46
+    // 居中计算: 128 - 3*12 = 92, 92/2 = 46
     OLED_PrintASCIIString(46, 20, buf, &afont24x12, OLED_COLOR_NORMAL);
 
-    // D. ײͼ
-    // 
-    uint8_t x_play = 55; // мͼX
+    // D. 底部控制图标
+    // 计算坐标
+    uint8_t x_play = 55; // 中间图标X
     uint8_t x_prev = x_play - ICON_GAP;
     uint8_t x_next = x_play + ICON_GAP;
     
-    uint8_t box_w = 22; // ѡп
+    uint8_t box_w = 22; // 选中框宽高
     uint8_t box_h = 22;
     uint8_t box_y = ICON_Y_POS - 2;
 
-    // 1. һͼ
+    // 1. 上一曲图标
     if (cursor == CURSOR_PREV) {
         OLED_DrawFilledRectangle(x_prev - 2, box_y, box_w, box_h, OLED_COLOR_NORMAL);
         OLED_DrawImage(x_prev, ICON_Y_POS, &leftImg, OLED_COLOR_REVERSED);
@@ -189,17 +189,17 @@ void App_MP3_Loop(void) {
         OLED_DrawImage(x_prev, ICON_Y_POS, &leftImg, OLED_COLOR_NORMAL);
     }
 
-    // 2. /ͣͼ
-    // ֱӵ MP3_IsPlaying() ӿڻȡ״̬
+    // 2. 播放/暂停图标
+    // 直接调用 MP3_IsPlaying() 接口获取状态
     uint8_t is_playing = MP3_IsPlaying();
     
     if (cursor == CURSOR_PLAY) {
         OLED_DrawFilledRectangle(x_play - 2, box_y, box_w, box_h, OLED_COLOR_NORMAL);
         if (is_playing) {
-            // ڲ -> ʾͣͼ (||)
+            // 正在播放 -> 显示暂停图标 (||)
             OLED_DrawImage(x_play, ICON_Y_POS, &playImg, OLED_COLOR_REVERSED);
         } else {
-            // ͣ -> ʾͼ (>)
+            // 暂停中 -> 显示播放图标 (>)
             OLED_DrawImage(x_play + 3, ICON_Y_POS + 1, &pauseImg, OLED_COLOR_REVERSED);
         }
     } else {
@@ -210,7 +210,7 @@ void App_MP3_Loop(void) {
         }
     }
 
-    // 3. һͼ
+    // 3. 下一曲图标
     if (cursor == CURSOR_NEXT) {
         OLED_DrawFilledRectangle(x_next - 2, box_y, box_w, box_h, OLED_COLOR_NORMAL);
         OLED_DrawImage(x_next, ICON_Y_POS, &rightImg, OLED_COLOR_REVERSED);
@@ -218,22 +218,22 @@ void App_MP3_Loop(void) {
         OLED_DrawImage(x_next, ICON_Y_POS, &rightImg, OLED_COLOR_NORMAL);
     }
 
-    // E. ڵ
+    // E. 音量调节弹窗
     if (is_vol_mode) {
-        // յ
+        // 清空弹窗区域
         OLED_DrawFilledRectangle(20, 20, 88, 24, OLED_COLOR_REVERSED); 
         OLED_DrawRectangle(20, 20, 88, 24, OLED_COLOR_NORMAL);
 
-        // ʾ ":" (˺֣ȷֿ֣ Vol)
-        OLED_ShowGBK(24, 24, "", 16, OLED_COLOR_NORMAL);
+        // 显示 "音量:" (这里用了汉字，确保你字库里有这两个字，否则用 Vol)
+        OLED_ShowGBK(24, 24, "音量", 16, OLED_COLOR_NORMAL);
         OLED_PrintASCIIString(56, 26, ":", &afont12x6, OLED_COLOR_NORMAL);
         
-        // 
+        // 进度条
         OLED_DrawRectangle(50, 26, 32, 10, OLED_COLOR_NORMAL);
-        uint8_t bar_w = (current_vol * 30) / 30; // 30
+        uint8_t bar_w = (current_vol * 30) / 30; // 30是最大音量
         if (bar_w > 0) OLED_DrawFilledRectangle(52, 28, bar_w, 6, OLED_COLOR_NORMAL);
 
-        // 
+        // 数字
         sprintf(buf, "%d", current_vol);
         OLED_PrintASCIIString(86, 26, buf, &afont12x6, OLED_COLOR_NORMAL);
     }
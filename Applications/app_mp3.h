@@ -1,7 +1,7 @@
 #ifndef __APP_MP3_H
 #define __APP_MP3_H
 
-// MP3 Ӧ
+// MP3 播放器应用入口
 void App_MP3_Loop(void);
 
 #endif
\ No newline at end of file
@@ -1,26 +1,26 @@
-#include "main.h"      // <--- ޸ HAL ͻ
+#include "main.h"      // <--- 核心修复：必须包含 HAL 库和基础类型
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
 
-#include "app_timer.h" // ͷļ (ԭ app_tools.h?)
+#include "app_timer.h" // 你的头文件 (原 app_tools.h?)
 #include "oled.h"
 #include "key.h"
 #include "menu_core.h"
 #include "clock.h"
-#include "mp3_player.h" //  MP3ͷļ
+#include "mp3_player.h" // 【新增】 引入MP3头文件
 #include "sys_params.h" 
-#include "sys_params.h" // ϵͳ
+#include "sys_params.h" // 【新增】引入参数系统
 
-// --- ֹ oled.h ûȷЩⲿ ---
-//  oled.h Ѿд extern const Font ...Щɾ
-// Ҳᱨȷͨ
+// --- 补丁：防止 oled.h 没有正确声明这些外部变量 ---
+// 如果你的 oled.h 里已经写了 extern const Font ...，这些可以删掉
+// 但留着也不会报错，能确保编译通过
 // extern const Font afont12x6;
 // extern const Font afont16x8;
 // extern const Font afont8x6;
 
 // ============================================================================
-//    1:  (Alarm)
+//   工具 1: 闹钟 (Alarm)
 // ============================================================================
 
 static uint8_t g_temp_h = 7;
@@ -28,16 +28,16 @@ static uint8_t g_temp_m = 0;
 static bool g_temp_enabled = false;
 static uint8_t edit_idx = 0; // 0:Hour, 1:Min, 2:Toggle
 
-// ý
+// 闹钟设置界面
 
-// ⲿӿʵ
+// 【新增】外部接口实现
 void Tools_SetAlarm(uint8_t h, uint8_t m, bool enable) {
     g_temp_h = h;
     g_temp_m = m;
     g_temp_enabled = enable;
 }
 
-//  (ʹ g_alarm_... )
+// 检查闹钟 (使用 g_alarm_... 变量)
 bool Tools_CheckAlarm(uint8_t current_h, uint8_t current_m) {
     if (!g_temp_enabled) return false;
     static uint8_t last_min = 60;
@@ -48,7 +48,7 @@ bool Tools_CheckAlarm(uint8_t current_h, uint8_t current_m) {
             return true; 
         }
     } else {
-        // ʱȥˣ÷Աͬһʱ䴥
+        // 时间过去了，重置防抖变量，以便明天同一时间触发
         if (last_min != 60 && current_m != g_temp_m) {
              last_min = 60; 
         }
@@ -56,7 +56,7 @@ bool Tools_CheckAlarm(uint8_t current_h, uint8_t current_m) {
     return false;
 }
 void App_Alarm_Set_Loop(void) {
-    // ʱ༭
+    // 临时编辑变量
     static uint8_t temp_h = 0;
     static uint8_t temp_m = 0;
     static bool temp_enabled = false;
@@ -64,7 +64,7 @@ void App_Alarm_Set_Loop(void) {
     static uint8_t edit_idx = 0; 
     static uint8_t inited = 0;
 
-    // 1. ʼȫֲṹ
+    // 1. 初始化：从全局参数结构体加载
     if (!inited) {
         temp_h = g_sys_params.alarm_h;
         temp_m = g_sys_params.alarm_m;
@@ -72,33 +72,33 @@ void App_Alarm_Set_Loop(void) {
         edit_idx = 0;
         inited = 1;
     }
-    //  UI
+    // 绘制 UI
     OLED_NewFrame();
     // OLED_PrintASCIIString(0, 0, "Set Alarm", &afont12x6, OLED_COLOR_NORMAL);
-    OLED_ShowGBK(0, 0, "", 16, OLED_COLOR_NORMAL);
+    OLED_ShowGBK(0, 0, "设置闹钟", 16, OLED_COLOR_NORMAL);
     char buf[20];
     sprintf(buf, "%02d:%02d", temp_h, temp_m);
     
-    // ʾʱ
+    // 居中显示时间
     OLED_PrintASCIIString(44, 24, buf, &afont16x8, OLED_COLOR_NORMAL);
     
-    // ʾ״̬
+    // 显示开关状态
     const char* status = temp_enabled ? "[ON]" : "[OFF]";
     OLED_PrintASCIIString(50, 48, (char*)status, &afont12x6, OLED_COLOR_NORMAL);
 
-    // ƹ (»)
+    // 绘制光标 (下划线)
     if (edit_idx < 2) {
-        // ʱ䲿: 44 + idx*24
+        // 时间部分: 44 + idx*24
         uint8_t x = 44 + edit_idx * 24;
         OLED_DrawLine(x, 42, x + 16, 42, OLED_COLOR_NORMAL);
     } else {
-        // ز
+        // 开关部分
         OLED_DrawLine(50, 60, 50 + 24, 60, OLED_COLOR_NORMAL);
     }
 
     OLED_ShowFrame();
 
-    // ߼
+    // 按键逻辑
     if (Key_IsSingleClick(KEY1_ID)) { // UP
         if (edit_idx == 0) temp_h = (temp_h + 1) % 24;
         if (edit_idx == 1) temp_m = (temp_m + 1) % 60;
@@ -112,13 +112,13 @@ void App_Alarm_Set_Loop(void) {
     if (Key_IsSingleClick(KEY2_ID)) { // OK
         edit_idx++;
         if (edit_idx > 2) {
-            // ġ߼
-            // 1. ȫֲ
+            // 【核心】保存逻辑
+            // 1. 更新全局参数
             g_sys_params.alarm_h = temp_h;
             g_sys_params.alarm_m = temp_m;
             g_sys_params.alarm_on = temp_enabled ? 1 : 0;
             
-            // 2. дFlashӦ (Apply_Params  Tools_SetAlarm  g_alarm_xxx)
+            // 2. 写入Flash并应用 (Apply_Params 会调用 Tools_SetAlarm 更新 g_alarm_xxx)
             System_Params_Save();
             
             inited = 0; 
@@ -129,7 +129,7 @@ void App_Alarm_Set_Loop(void) {
 
 
 // ============================================================================
-//    2:  (Stopwatch)
+//   工具 2: 秒表 (Stopwatch)
 // ============================================================================
 
 typedef enum {
@@ -137,28 +137,28 @@ typedef enum {
     SW_RUNNING
 } StopwatchState;
 
-// λö
+// 光标位置定义
 enum {
-    SW_CURSOR_BACK = 0, // Ͻ <<
-    SW_CURSOR_LEFT,     // ½ (Start/Lap)
-    SW_CURSOR_RIGHT     // ½ (Reset/Stop)
+    SW_CURSOR_BACK = 0, // 左上角 <<
+    SW_CURSOR_LEFT,     // 左下角 (Start/Lap)
+    SW_CURSOR_RIGHT     // 右下角 (Reset/Stop)
 };
 
 static StopwatchState sw_state = SW_STOPPED;
 static uint32_t start_tick = 0;
-static uint32_t elapsed_ms = 0; // ۼƺ
-static uint32_t record_ms[3] = {0}; // ¼3
+static uint32_t elapsed_ms = 0; // 累计毫秒数
+static uint32_t record_ms[3] = {0}; // 最多记录3条
 static uint8_t record_count = 0;
-static uint8_t sw_cursor = SW_CURSOR_LEFT; // 
+static uint8_t sw_cursor = SW_CURSOR_LEFT; // 新增：秒表界面光标
 
 void App_Stopwatch_Loop(void) {
-    // 1. 㵱ǰʱ
+    // 1. 计算当前时间
     uint32_t current_display_ms = elapsed_ms;
     if (sw_state == SW_RUNNING) {
         current_display_ms += (HAL_GetTick() - start_tick);
     }
     
-    // 2. ʽʱ
+    // 2. 格式化时间
     uint16_t min = (current_display_ms / 60000) % 60;
     uint16_t sec = (current_display_ms / 1000) % 60;
     uint16_t ms  = (current_display_ms % 1000) / 10; 
@@ -166,10 +166,10 @@ void App_Stopwatch_Loop(void) {
     char main_buf[15];
     sprintf(main_buf, "%02d:%02d.%02d", min, sec, ms);
 
-    // 3.  UI
+    // 3. 绘制 UI
     OLED_NewFrame();
     
-    // ؼ
+    // 顶部栏：返回键
     if (sw_cursor == SW_CURSOR_BACK) {
         OLED_DrawFilledRectangle(0, 0, 16, 10, OLED_COLOR_NORMAL);
         OLED_PrintASCIIString(2, 1, "<<", &afont12x6, OLED_COLOR_REVERSED);
@@ -177,12 +177,12 @@ void App_Stopwatch_Loop(void) {
         OLED_PrintASCIIString(2, 1, "<<", &afont12x6, OLED_COLOR_NORMAL);
     }
     // OLED_PrintASCIIString(40, 0, "Stopwatch", &afont12x6, OLED_COLOR_NORMAL);
-    OLED_ShowGBK(40, 0, "ʱ", 16, OLED_COLOR_NORMAL);
+    OLED_ShowGBK(40, 0, "计时器", 16, OLED_COLOR_NORMAL);
 
-    // ʾʱ
+    // 大数字显示时间
     OLED_PrintASCIIString(34, 16, main_buf, &afont16x8, OLED_COLOR_NORMAL);
     
-    // ¼б
+    // 记录列表
     for (int i = 0; i < record_count; i++) {
         uint16_t r_min = (record_ms[i] / 60000) % 60;
         uint16_t r_sec = (record_ms[i] / 1000) % 60;
@@ -192,7 +192,7 @@ void App_Stopwatch_Loop(void) {
         OLED_PrintASCIIString(10, 34 + i*10, sub_buf, &afont8x6, OLED_COLOR_NORMAL);
     }
 
-    // ײܼ
+    // 底部功能键
     OLED_DrawLine(0, 52, 128, 52, OLED_COLOR_NORMAL); 
     
     const char *txt_left;
@@ -206,7 +206,7 @@ void App_Stopwatch_Loop(void) {
         txt_right = "Stop";
     }
 
-    // ½ǰť
+    // 左下角按钮
     if (sw_cursor == SW_CURSOR_LEFT) {
         OLED_DrawFilledRectangle(0, 54, 34, 10, OLED_COLOR_NORMAL);
         OLED_PrintASCIIString(2, 55, (char*)txt_left, &afont8x6, OLED_COLOR_REVERSED);
@@ -214,7 +214,7 @@ void App_Stopwatch_Loop(void) {
         OLED_PrintASCIIString(2, 55, (char*)txt_left, &afont8x6, OLED_COLOR_NORMAL);
     }
 
-    // ½ǰť
+    // 右下角按钮
     if (sw_cursor == SW_CURSOR_RIGHT) {
         OLED_DrawFilledRectangle(98, 54, 30, 10, OLED_COLOR_NORMAL);
         OLED_PrintASCIIString(100, 55, (char*)txt_right, &afont8x6, OLED_COLOR_REVERSED);
@@ -224,18 +224,18 @@ void App_Stopwatch_Loop(void) {
     
     OLED_ShowFrame();
 
-    // 4. 
-    if (Key_IsSingleClick(KEY1_ID)) { // ƶ
+    // 4. 按键处理
+    if (Key_IsSingleClick(KEY1_ID)) { // 移动光标
         if (sw_cursor > 0) sw_cursor--;
         else sw_cursor = SW_CURSOR_RIGHT;
     }
 
-    if (Key_IsSingleClick(KEY3_ID)) { // ƶ
+    if (Key_IsSingleClick(KEY3_ID)) { // 移动光标
         if (sw_cursor < SW_CURSOR_RIGHT) sw_cursor++;
         else sw_cursor = SW_CURSOR_BACK;
     }
 
-    if (Key_IsSingleClick(KEY2_ID)) { // ִ
+    if (Key_IsSingleClick(KEY2_ID)) { // 执行
         switch (sw_cursor) {
             case SW_CURSOR_BACK: 
                 sw_state = SW_STOPPED;
@@ -271,18 +271,18 @@ void App_Stopwatch_Loop(void) {
     }
 }
 
-// 
+// 闹钟响铃界面
 void App_Alarm_Ring_Loop(void) {
     static uint32_t flash_tick = 0;
     static bool flash_state = false;
     static uint8_t is_sound_started = 0;    
     if (is_sound_started == 0) {
-        MP3_SetVolume(25); //  (0-30)
-        MP3_PlayTrack(34); // ġŵ34
-        is_sound_started = 1; // Ѳ
+        MP3_SetVolume(25); // 设置闹钟音量 (0-30)
+        MP3_PlayTrack(34); // 【核心】播放第34首曲子
+        is_sound_started = 1; // 标记已播放
     }
 
-    // 2. Ļ˸߼
+    // 2. 屏幕闪烁逻辑
     if (HAL_GetTick() - flash_tick >= 200) {
         flash_tick = HAL_GetTick();
         flash_state = !flash_state;
@@ -292,19 +292,19 @@ void App_Alarm_Ring_Loop(void) {
     OLED_NewFrame();
     if (flash_state) {
         // OLED_PrintASCIIString(30, 20, "WAKE UP!", &afont16x8, OLED_COLOR_REVERSED);
-        OLED_ShowGBK(30, 20, "ʱ䵽", 16, OLED_COLOR_REVERSED);
+        OLED_ShowGBK(28, 14, "时间到", 24, OLED_COLOR_REVERSED);
     } else {
         // OLED_PrintASCIIString(30, 20, "WAKE UP!", &afont16x8, OLED_COLOR_NORMAL);
-        OLED_ShowGBK(30, 20, "ʱ䵽", 16, OLED_COLOR_NORMAL);
+        OLED_ShowGBK(28, 14, "时间到", 24, OLED_COLOR_NORMAL);
     }
     // OLED_PrintASCIIString(10, 48, "Press Any Key", &afont12x6, OLED_COLOR_NORMAL);
-    OLED_ShowGBK(10, 48, "", 16, OLED_COLOR_NORMAL);
+    OLED_ShowGBK(10, 48, "按任意键", 16, OLED_COLOR_NORMAL);
     OLED_ShowFrame();
 
     if (Key_IsSingleClick(KEY1_ID) || Key_IsSingleClick(KEY2_ID) || Key_IsSingleClick(KEY3_ID)) {
         MP3_Stop();
         is_sound_started = 0;
-        OLED_SetColorMode(0); // ָ
+        OLED_SetColorMode(0); // 恢复正常
         Menu_SwitchToMenu();
     }
 }
\ No newline at end of file
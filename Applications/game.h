@@ -4,10 +4,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-// Ϸں
+// 游戏入口函数
 void App_Tetris_Loop(void);
 
-// ԤϷĽӿ
+// 预留给恐龙游戏的接口
 // void App_Dino_Loop(void); 
 
 #endif
\ No newline at end of file
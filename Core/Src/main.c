@@ -27,19 +27,21 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-#include "oled.h" // ����OLED������
-#include "yx5200_hal.h"  // <--- �����������һ�С���� YX5200 ��������
+#include "oled.h" // 锟斤拷锟斤拷OLED锟斤拷锟斤拷锟斤拷
+#include "yx5200_hal.h"  // <--- 锟斤拷锟斤拷锟斤拷锟斤拷锟斤拷锟揭伙拷小锟斤拷锟斤拷 YX5200 锟斤拷锟斤拷锟斤拷锟斤拷
 #include "mpu6050.h"
-#include "key.h"  // �ո�д�İ�������
+#include "key.h"  // 锟秸革拷写锟侥帮拷锟斤拷锟斤拷锟斤拷
 #include "w25qxx.h"
-#include <string.h> // ��Ҫ�õ� memcmp
-#include "mp3_player.h" // <--- �����·�װ��ͷ�ļ�
-#include <stdio.h>      // ���� sprintf
+#include "font_pack.h"
+#include "flash_job.h"
+#include <string.h> // 锟斤拷要锟矫碉拷 memcmp
+#include "mp3_player.h" // <--- 锟斤拷锟斤拷锟铰凤拷装锟斤拷头锟侥硷拷
+#include <stdio.h>      // 锟斤拷锟斤拷 sprintf
 // #include "mp3_test.h"
 // #include "burn_data.h"
-#include "clock.h"   // <--- ������ʱ��ģ��
-#include "menu_core.h" // <--- �������˵�����ģ��
-#include "battery.h" // <--- ��ȷ����һ�д��ڡ�
+#include "clock.h"   // <--- 锟斤拷锟斤拷锟斤拷时锟斤拷模锟斤拷
+#include "menu_core.h" // <--- 锟斤拷锟斤拷锟斤拷锟剿碉拷锟斤拷锟斤拷模锟斤拷
+#include "battery.h" // <--- 锟斤拷确锟斤拷锟斤拷一锟叫达拷锟节★拷
 #include "app_power.h"
 #include "app_about.h"
 #include "app_message.h"
@@ -70,7 +72,7 @@ extern uint32_t timer;
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 /* USER CODE BEGIN PFP */
-void I2C_Scanner(void); // �����һ�????????
+void I2C_Scanner(void); // 锟斤拷锟斤拷锟揭伙拷锟????????
 
 /* USER CODE END PFP */
 
@@ -116,6 +118,8 @@ int main(void)
   MX_RTC_Init();
   /* USER CODE BEGIN 2 */
    W25Q_Init();    
+  FontPack_Init(); // 读取字库头部
+  OLED_SetPort(&OLED_PortSTM32);
   OLED_Init();    
   Battery_Init(); 
   Clock_Init();   
@@ -147,8 +151,10 @@ int main(void)
     if (HAL_GetTick() - mpu_tick >= 10) 
     {
         mpu_tick = HAL_GetTick();
-        MPU6050_Update_Task(); // ������Զ�ȥ���? hi2c2 ��ȡ
+        MPU6050_Update_Task(); // 锟斤拷锟斤拷锟斤拷远锟饺ワ拷锟斤拷锟? hi2c2 锟斤拷取
     }
+    FlashJob_Task(); // 后台擦除/写入外部Flash
+    if (!FlashJob_Pending()) FontPack_VerifyStep(); // 空闲时分段校验字库
    if (Power_Update()) 
     {
         Menu_Loop();
@@ -55,8 +55,8 @@ void MX_RTC_Init(void)
   /* USER CODE BEGIN Check_RTC_BKUP */
 if (HAL_RTCEx_BKUPRead(&hrtc, RTC_BKP_DR1) == RTC_BKP_SIGNATURE)
   {
-      // Ѿʼˣֱӷأֵǰʱ
-      // Ӹڴӡԣ printf("RTC running on VBAT, time kept.\n");
+      // 已经初始化过了，直接返回，保持当前时间继续走
+      // 可以在这里加个串口打印调试： printf("RTC running on VBAT, time kept.\n");
       return; 
   }
 
@@ -3,23 +3,23 @@
 #include "oled.h"
 #include "key.h"
 #include "mpu6050.h"
-#include <math.h> // Ҫõ fabs
+#include <math.h> // 需要用到 fabs
 
-// ================= ò =================
+// ================= 配置参数 =================
 
-// ˶ֵ (ٶ֮)
-// MPU6050 Gx, Gy, Gz λͨ /(/s)  /
-// ֵ150.0 ~ 300.0
-// ֵԽСԽᶯһ¾ֵԽҪ˦Խ
+// 运动唤醒阈值 (角速度之和)
+// MPU6050输出的 Gx, Gy, Gz 单位通常是 度/秒(°/s) 或 弧度/秒
+// 建议值：150.0 ~ 300.0
+// 值越小越灵敏（轻轻动一下就亮），值越大需要甩得越快
 #define WAKE_MOTION_THRESHOLD  500.0f  
 
-// ֵ ()
-// ֻ N μ⵽˶Żѣֹż
+// 连续检测计数器阈值 (防抖)
+// 只有连续 N 次检测到剧烈运动才唤醒，防止偶尔震动误触
 #define WAKE_COUNT_THRESHOLD   2
 
 // ===========================================
 
-// --- ڲ״̬ ---
+// --- 内部状态 ---
 typedef enum {
     SYS_ACTIVE,
     SYS_SLEEP
@@ -29,10 +29,10 @@ static uint32_t g_sleep_timeout = 10000;
 static SystemState_t current_state = SYS_ACTIVE;
 static uint32_t last_activity_tick = 0;
 
-// ⲿ MPU ݻȡӿ
+// 外部引用 MPU 数据获取接口
 extern const MPU6050_t* MPU6050_GetDataPtr(void);
 
-// --- ڲ ---
+// --- 内部辅助函数 ---
 
 void Power_SetTimeout(uint32_t ms) {
     g_sleep_timeout = ms;
@@ -46,49 +46,49 @@ uint32_t Power_GetTimeout(void) {
 static void Enter_Sleep(void) {
     if (current_state == SYS_SLEEP) return;
     
-    OLED_DisPlay_Off(); // 
-    // ӹر LEDƵ߼
+    OLED_DisPlay_Off(); // 关屏
+    // 这里可以添加关闭 LED、降低主频等逻辑
     current_state = SYS_SLEEP;
 }
 
 static void Exit_Sleep(void) {
     if (current_state == SYS_ACTIVE) return;
     
-    OLED_DisPlay_On();  // 
-    Power_ResetTimer(); // Ϩʱ
+    OLED_DisPlay_On();  // 开屏
+    Power_ResetTimer(); // 重置熄屏倒计时
     current_state = SYS_ACTIVE;
 }
 
-// Ƿ㡰˶
-//  true ʾ⵽̧/˦ֶ
+// 检查是否满足“剧烈运动”唤醒条件
+// 返回 true 表示检测到了抬手/甩手动作
 static bool Check_Raise_Wakeup(void) {
-    static uint8_t motion_cnt = 0; // 
+    static uint8_t motion_cnt = 0; // 动作持续计数器
     const MPU6050_t* mpu = MPU6050_GetDataPtr();
     
-    // 㵱ǰ˶ǿ
-    // ԭֹʱٶ(G)ӽ0˶ԽGԽ
-    // ʹþֵ֮˶
+    // 计算当前的运动强度
+    // 原理：静止时角速度(G)接近0，运动越快G越大
+    // 使用绝对值之和来评估整体运动量
     double total_motion = fabs(mpu->Gx) + fabs(mpu->Gy) + fabs(mpu->Gz);
     
-    // ãȷֵӡ total_motion 
+    // 调试用：如果不确定阈值，可以在这里打印 total_motion 到串口
     // printf("Motion: %f\n", total_motion);
 
     if (total_motion > WAKE_MOTION_THRESHOLD) {
         motion_cnt++;
     } else {
-        motion_cnt = 0; // жϣ
+        motion_cnt = 0; // 如果动作中断，计数清零
     }
 
-    // ֻ⵽θǿ˶ΪЧ̧
+    // 只有连续检测到几次高强度运动，才认为是有效抬手
     if (motion_cnt >= WAKE_COUNT_THRESHOLD) {
-        motion_cnt = 0; // 
+        motion_cnt = 0; // 重置
         return true;
     }
     
     return false;
 }
 
-// --- ӿ ---
+// --- 公共接口 ---
 
 void Power_Init(void) {
     current_state = SYS_ACTIVE;
@@ -102,8 +102,8 @@ void Power_ResetTimer(void) {
 bool Power_Update(void) {
     uint32_t now = HAL_GetTick();
 
-    // 1. ״̬ (͵ƽЧǸߵƽЧʵӲȷ)
-    //  Key_GetRawState  0 ʾ
+    // 1. 按键物理状态检测 (低电平有效还是高电平有效请根据实际硬件确认)
+    // 假设 Key_GetRawState 返回 0 表示按下
     bool key_pressed = false;
     if (Key_GetRawState(KEY1_ID) == 0 || 
         Key_GetRawState(KEY2_ID) == 0 || 
@@ -112,31 +112,31 @@ bool Power_Update(void) {
         key_pressed = true;
     }
 
-    // ================= ״̬߼ =================
+    // ================= 状态机逻辑 =================
     
     if (current_state == SYS_ACTIVE) {
-        // --- [Ծģʽ] ---
+        // --- [活跃模式] ---
         
-        // A. аϨʱ
+        // A. 有按键操作，重置熄屏计时
         if (key_pressed) {
             Power_ResetTimer();
         }
         
-        // B. 鳬ʱ -> 
-        // (g_sleep_timeout Ϊ 0 ʱ)
+        // B. 检查超时 -> 进入休眠
+        // (g_sleep_timeout 为 0 时代表永不休眠)
         if (g_sleep_timeout > 0 && (now - last_activity_tick > g_sleep_timeout)) {
             Enter_Sleep();
-            return false; // ֹͣ UI ˢ
+            return false; // 停止 UI 刷新
         }
         
-        return true; //  UI
+        return true; // 继续运行 UI
     } 
     else {
-        // --- [ģʽ] ---
+        // --- [休眠模式] ---
         
-        // A. ⰴ
+        // A. 检测按键唤醒
         if (key_pressed) {
-            // ĵΰ¼ֹ˲󴥲˵
+            // 消耗掉这次按键事件，防止点亮瞬间误触菜单
             Key_IsSingleClick(KEY1_ID);
             Key_IsSingleClick(KEY2_ID);
             Key_IsSingleClick(KEY3_ID);
@@ -146,15 +146,15 @@ bool Power_Update(void) {
             return true; 
         }
         
-        // B. ̧/ (ڽٶȱ仯)
-        // ֻеת̧ٶȣʱŻᴥ
-        // ֹƽʱٶΪ0ᴥӶ˸
+        // B. 检测抬手/动作唤醒 (基于角速度变化)
+        // 只有当你手腕转动、抬起（有速度）时才会触发
+        // 静止平放时，角速度为0，不会触发，从而解决了闪烁问题
         if (Check_Raise_Wakeup()) {
             Exit_Sleep();
             return true;
         }
         
-        // нͼƵ
+        // 休眠中降低检测频率
         HAL_Delay(50); 
         return false;
     }
@@ -1,38 +1,40 @@
 #include "menu_core.h"
 #include "oled.h"
+#include "text_layout.h"
+#include "text_strip.h"
 #include "key.h"
-#include "clock.h" // ʱ
+#include "clock.h" // 仅用于时间更新
 #include "app_timer.h" 
-// ȫֿƿ
+// 全局控制块
 static MenuCtrl g_menu;
 
-// ⲿdata.cжĳʼ
+// 外部声明：在data.c中定义的初始化辅助函数
 extern void Menu_LoadInitialState(MenuCtrl *ctrl);
 
 static void Menu_Draw_PowerPopup(void) {
-    // ֱ䣨ȵ OLED_NewFrame() ϲã
-    // Ϊͻ NewFrame ֱԭϸһ
-    // ƣԵøɾ
+    // 保持背景不变（或者你可以先调 OLED_NewFrame() 清屏，看喜好）
+    // 为了突出弹窗，这里我们用 NewFrame 清除背景，或者直接在原画面上盖一个框
+    // 简单起见，我们清屏绘制，显得干净
     OLED_NewFrame(); 
     
-    // һ
+    // 画一个大框
     OLED_DrawRectangle(10, 10, 108, 44, OLED_COLOR_NORMAL);
     
-    //  "Power Off?"
-    // У128 - (10ַ*8) = 48 -> x=48/2=24 ?? 
-    // "Power Off?" 10font16x88 -> 80px. 128-80=48, start=24
+    // 标题 "Power Off?"
+    // 居中：128 - (10字符*8) = 48 -> x=48/2=24 ?? 
+    // "Power Off?" 长度10，font16x8宽8 -> 80px. 128-80=48, start=24
     OLED_PrintASCIIString(24, 16, "Power Off?", &afont16x8, OLED_COLOR_NORMAL);
     
-    // ѡʾ (:, :)
-    // KEY1 ()KEY3 ұ()
+    // 选项提示 (左:是, 右:否)
+    // KEY1 在左边(物理上)，KEY3 在右边(物理上)
     
-    // ½ʾ "[YES]"
-    OLED_DrawFilledRectangle(14, 38, 30, 12, OLED_COLOR_NORMAL);
-    OLED_PrintASCIIString(16, 40, "YES", &afont8x6, OLED_COLOR_REVERSED); // ɫ
+    // 左下角显示 "[YES]"
+    OLED_PrintASCIIString(16, 40, "YES", &afont8x6, OLED_COLOR_NORMAL);
+    OLED_InvertArea(14, 38, 31, 12); // 反色高亮
     
-    // ½ʾ "[NO]"
-    OLED_DrawFilledRectangle(84, 38, 24, 12, OLED_COLOR_NORMAL);
-    OLED_PrintASCIIString(88, 40, "NO", &afont8x6, OLED_COLOR_REVERSED);  // ɫ
+    // 右下角显示 "[NO]"
+    OLED_PrintASCIIString(88, 40, "NO", &afont8x6, OLED_COLOR_NORMAL);
+    OLED_InvertArea(84, 38, 25, 12); // 反色高亮
     
     OLED_ShowFrame();
 }
@@ -40,44 +42,44 @@ static void Menu_Draw_PowerPopup(void) {
 
 static void Menu_Process_PowerPopup(void) {
     
-    //  (KEY1) -> ȷϹػ
+    // 左键 (KEY1) -> 确认关机
     if (Key_IsSingleClick(KEY1_ID)) {
-        // --- ִйػ ---
+        // --- 执行关机动作 ---
         
-        // 1. 淴
+        // 1. 界面反馈
         OLED_NewFrame();
-        OLED_ShowGBK(32, 24, "ټ", 16, OLED_COLOR_NORMAL);
+        OLED_ShowGBK(32, 24, "再见", 16, OLED_COLOR_NORMAL);
         OLED_ShowFrame();
         HAL_Delay(500);
         
-        // 2. رĻ
+        // 2. 关闭屏幕
         OLED_DisPlay_Off();
         
-        // 3.  PB13 (ػ)
+        // 3. 拉低 PB13 (关机引脚)
         HAL_GPIO_WritePin(GPIOB, GPIO_PIN_13, GPIO_PIN_RESET);
         
-        // 4. ѭȴԴж
+        // 4. 死循环，等待电源切断
         while(1) {
-            // ѡӲǰ°ܿﲻҪκ
-            // ػҪάֵ͵ƽ⿨ס
+            // 可选：如果硬件设计是按下按键才能开机，这里不需要做任何事
+            // 如果是软关机需要维持低电平，就在这卡住
         }
     }
     
-    // Ҽ (KEY3) -> ȡһ
+    // 右键 (KEY3) -> 取消，返回上一界面
     if (Key_IsSingleClick(KEY3_ID)) {
-        g_menu.mode = g_menu.last_mode; // ָ֮ǰģʽ
-        // ע⣺Ҫָ棬һ Loop Զػ
+        g_menu.mode = g_menu.last_mode; // 恢复之前的模式
+        // 注意：不需要恢复画面，下一次 Loop 会自动重绘
     }
 }
 
-// 3.  KEY4  (ȫּ)
+// 3. 检测 KEY4 长按 (全局检测)
 static void Menu_Check_PowerKey(void) {
     static uint32_t press_start_tick = 0;
     static uint8_t is_pressing = 0;
     
-    // ǰѾڵˣͲⳤˣظ
+    // 如果当前已经在弹窗了，就不检测长按了，避免重复触发
     if (g_menu.mode == SYS_MODE_POWER_POPUP) {
-        // ɿ״̬
+        // 如果松开按键，重置状态
         if (Key_GetRawState(KEY2_ID) == 1) {
             is_pressing = 0;
             press_start_tick = 0;
@@ -85,71 +87,64 @@ static void Menu_Check_PowerKey(void) {
         return;
     }
 
-    //  KEY4 ״̬ (0Ϊ)
+    // 检测 KEY4 物理状态 (0为按下)
     if (Key_GetRawState(KEY2_ID) == 0) {
         if (is_pressing == 0) {
-            // հ£¼ʱ
+            // 刚按下，记录时间
             is_pressing = 1;
             press_start_tick = HAL_GetTick();
         } 
         else {
-            // Уʱ
+            // 持续按下中，检查时间
             if ((HAL_GetTick() - press_start_tick) > 3000) { // > 5000ms
-                // лģʽ
-                g_menu.last_mode = g_menu.mode; // ݵǰģʽ
+                // 触发！切换到弹窗模式
+                g_menu.last_mode = g_menu.mode; // 备份当前模式
                 g_menu.mode = SYS_MODE_POWER_POPUP;
                 
-                // ѡΪ˷ֹʱ¼(KEY4ԭMenu?)
-                //  KEY4 ̰ܣﳤӦ跨ζ̰
-                //  Key_IsSingleClick Ҳǻ״̬ģﳤһֱ֣
-                // ̰߼Ӧòᴥǿֶһ
+                // 可选：为了防止松手时触发单击事件(KEY4原本是Menu键?)
+                // 如果 KEY4 有其他短按功能，这里长按触发后应设法屏蔽短按
+                // 由于 Key_IsSingleClick 也是基于状态机的，这里长按一直不松手，
+                // 短按逻辑应该不会触发，或者我们可以手动清除一下
             }
         }
     } else {
-        // ɿ
+        // 松开
         is_pressing = 0;
         press_start_tick = 0;
     }
 }
 
-// ---  ---
+// --- 辅助函数 ---
 void Menu_SwitchToApp(AppLoopCallback app_func) {
     g_menu.mode = SYS_MODE_APP;
     g_menu.current_app = app_func;
-    OLED_NewFrame(); // ֹӰ
+    OLED_NewFrame(); // 清屏防止残影
 }
 
 void Menu_SwitchToMenu(void) {
     g_menu.mode = SYS_MODE_MENU;
-    // ﱣϴε current_pageΪ Page_Main
+    // 这里保持上次的 current_page，或者你可以重置为 Page_Main
 }
 
-// --- ˵ ---
-#define MAX_VISIBLE_LINES 4 // Ļʾ
+// --- 菜单绘制引擎 ---
+#define MAX_VISIBLE_LINES 4 // 屏幕能显示几行
 void Menu_Draw_GenericList(void) {
     MenuPage *page = g_menu.current_page;
     OLED_NewFrame();
     
-    // Ƿб⣬оͻ
+    // 检查是否有标题，如果有就画出来
     if (page->title) {
-        // ôһֿ⣬
-        uint8_t title_len = 0;
-        // жǷģֽ > 127
-        if ((uint8_t)page->title[0] > 0x80) {
-            title_len = (strlen(page->title) / 3) * 16; // ÿ16px
-        } else {
-            title_len = strlen(page->title) * 6;
-        }
-        uint8_t title_x = (128 - title_len) / 2;
-        if ((uint8_t)page->title[0] > 0x80) {
-            OLED_ShowGBK(title_x, 0, (char*)page->title, 16, OLED_COLOR_NORMAL);
-        } else {
-            OLED_PrintASCIIString(title_x, 2, (char*)page->title, &afont12x6, OLED_COLOR_NORMAL);
-        }
+        // 标题用大一点的字库，居中
+        // 简单判断是否包含中文（首字节 > 127）
+        uint8_t is_chinese = ((uint8_t)page->title[0] > 0x80);
+        uint8_t title_len = Text_Layout(page->title, is_chinese ? NULL : &afont12x6, 16)->width;
+        uint8_t title_x = (title_len < 128) ? (128 - title_len) / 2 : 0;
+        // 标题是常量字符串, 用预渲染的文字条 (ASCII 在16行中垂直居中, 即 y=2)
+        TextStrip_Draw(title_x, 0, page->title, is_chinese ? NULL : &afont12x6, 16, OLED_COLOR_NORMAL);
         OLED_DrawLine(0, 15, 128, 15, OLED_COLOR_NORMAL);
     }
     
-    // ӱ·ʼƲ˵
+    // 从标题下方开始绘制菜单项
     uint8_t start_y = page->title ? 16 : 0;
     uint8_t max_lines = (page->title) ? 3 : 4;
 
@@ -160,155 +155,159 @@ void Menu_Draw_GenericList(void) {
         uint8_t y = start_y + i * 16; 
         const MenuItem *item = &page->items[item_idx];
         
-        // жĻӢ
+        // 智能判断是中文还是英文
         uint8_t is_chinese = ((uint8_t)item->name[0] > 0x80);
 
-        // Ƿѡ״̬
+        // 选中状态: 整行点亮, 文字条反色贴上去 (每行只是一两次贴图)
+        OLED_ColorMode mode = OLED_COLOR_NORMAL;
         if (item_idx == g_menu.cursor_pos) {
-            OLED_DrawFilledRectangle(0, y, 128, 16, OLED_COLOR_NORMAL); // ͳһɫ
-            
-            if (is_chinese) {
-                OLED_ShowGBK(2, y, (char*)item->name, 16, OLED_COLOR_REVERSED);
-            } else {
-                OLED_PrintASCIIString(2, y+2, (char*)item->name, &afont12x6, OLED_COLOR_REVERSED);
-            }
-        } else {
-            // δѡ״̬
-            if (is_chinese) {
-                OLED_ShowGBK(2, y, (char*)item->name, 16, OLED_COLOR_NORMAL);
-            } else {
-                OLED_PrintASCIIString(2, y+2, (char*)item->name, &afont12x6, OLED_COLOR_NORMAL);
-            }
+            OLED_FillArea(0, y, 128, 16, OLED_COLOR_NORMAL);
+            mode = OLED_COLOR_REVERSED;
         }
+        TextStrip_Draw(2, y, item->name, is_chinese ? NULL : &afont12x6, 16, mode);
     }
-    OLED_ShowFrame();
+    OLED_ShowFrameAsync();
 }
 
-//  Core/Src/menu_core.c 
+// 在 Core/Src/menu_core.c 中
+
+// --- 轮播选中框 (四角) ---
+// 框的位置固定, 只在第一次使用时画到画布上, 之后每帧叠加
+#define CAROUSEL_FRAME_X  42  // 框左上角 (cx - 2)
+#define CAROUSEL_FRAME_Y  4   // 框左上角 (cy - 2), 画布从第0行开始以保持页对齐
+#define CAROUSEL_FRAME_W  44  // IMG_W + 4
+#define CAROUSEL_FRAME_H  44  // IMG_H + 4
+static uint8_t carousel_frame_buf[OLED_CANVAS_SIZE(CAROUSEL_FRAME_W + 1, CAROUSEL_FRAME_Y + CAROUSEL_FRAME_H + 1)];
+static Canvas carousel_frame = {CAROUSEL_FRAME_W + 1, CAROUSEL_FRAME_Y + CAROUSEL_FRAME_H + 1, carousel_frame_buf};
+
+static const Canvas *Carousel_GetFrame(void) {
+    static uint8_t ready = 0;
+    if (ready) return &carousel_frame;
+
+    uint8_t bx = 0;
+    uint8_t by = CAROUSEL_FRAME_Y;
+    uint8_t bw = CAROUSEL_FRAME_W;
+    uint8_t bh = CAROUSEL_FRAME_H;
+    uint8_t len = 6;
+
+    OLED_ClearCanvas(&carousel_frame);
+    OLED_SetTarget(&carousel_frame);
+    // 左上角
+    OLED_DrawLine(bx, by, bx + len, by, OLED_COLOR_NORMAL);
+    OLED_DrawLine(bx, by, bx, by + len, OLED_COLOR_NORMAL);
+    // 右上角
+    OLED_DrawLine(bx + bw, by, bx + bw - len, by, OLED_COLOR_NORMAL);
+    OLED_DrawLine(bx + bw, by, bx + bw, by + len, OLED_COLOR_NORMAL);
+    // 左下角
+    OLED_DrawLine(bx, by + bh, bx + len, by + bh, OLED_COLOR_NORMAL);
+    OLED_DrawLine(bx, by + bh, bx, by + bh - len, OLED_COLOR_NORMAL);
+    // 右下角
+    OLED_DrawLine(bx + bw, by + bh, bx + bw - len, by + bh, OLED_COLOR_NORMAL);
+    OLED_DrawLine(bx + bw, by + bh, bx + bw, by + bh - len, OLED_COLOR_NORMAL);
+    OLED_SetTarget(NULL);
+
+    ready = 1;
+    return &carousel_frame;
+}
 
 void Menu_Draw_Carousel(void) {
     MenuPage *page = g_menu.current_page;
     OLED_NewFrame();
     
-    // --- 2. Ƶǰ (ײ) - ޸Ĳ֡ ---
+    // --- 2. 绘制当前项的文字 (底部居中) - 【修改部分】 ---
     const MenuItem *center_item = &page->items[g_menu.cursor_pos];
     
-    //  name ָǷЧֹ NULL  strlen 
+    // 检查 name 指针是否有效，防止 NULL 导致崩溃
     if (center_item->name != NULL) { 
-        // жĻӢ (UTF-8 ַֽ > 0x80)
+        // 智能判断是中文还是英文 (GBK 编码的中文字符首字节 > 0x80)
         uint8_t is_chinese = ((uint8_t)center_item->name[0] > 0x80);
-        uint8_t text_x;
+        // 按实际绘制的字体测量宽度后居中 (菜单名是常量字符串, 排版结果按指针缓存)
+        uint8_t name_len = Text_Layout(center_item->name, is_chinese ? NULL : &afont12x6, 16)->width;
+        uint8_t text_x = (name_len < 128) ? (128 - name_len) / 2 : 0;
 
         if (is_chinese) {
-            // ·
-            // ꣺ÿֿ 16 
-            uint8_t char_count = strlen(center_item->name) / 3; // UTF-8 һռ3ֽ
-            text_x = ((128 - char_count * 16) / 2) - 6;
-            
-            // úʾ
-            OLED_ShowGBK(text_x, 48, (char*)center_item->name, 16, OLED_COLOR_NORMAL);
+            // 【中文路径】
+            TextStrip_Draw(text_x, 48, center_item->name, NULL, 16, OLED_COLOR_NORMAL);
         } else {
-            // Ӣ· (ԭ߼)
-            // ꣺ʹ afont12x6ÿַ 6 
-            uint8_t name_len = strlen(center_item->name);
-            text_x = (128 - name_len * 6) / 2; 
-            
-            //  ASCII ʾ
-            OLED_PrintASCIIString(text_x, 54, (char*)center_item->name, &afont12x6, OLED_COLOR_NORMAL);
+            // 【英文路径】 使用 afont12x6, 文字在 y=54 (文字条顶部 52)
+            TextStrip_Draw(text_x, 52, center_item->name, &afont12x6, 16, OLED_COLOR_NORMAL);
         }
     }
-    // --- ޸Ľ ---
+    // --- 【修改结束】 ---
 
-    // 3. 
+    // 3. 计算索引
     int8_t idx_left  = (g_menu.cursor_pos - 1 + page->item_count) % page->item_count;
     int8_t idx_right = (g_menu.cursor_pos + 1) % page->item_count;
     int8_t idx_center = g_menu.cursor_pos;
 
-    // --- 4. 궨 ---
+    // --- 4. 坐标定义 ---
     const uint8_t IMG_W = 40;
     const uint8_t IMG_H = 40;
     uint8_t cx = 44;
     uint8_t cy = 6;
     uint8_t side_y_offset = 8; 
 
-    // ͼƬ
+    // 绘制左侧图片
     if (page->item_count > 1) { 
         if (page->items[idx_left].icon) {
             OLED_DrawImage(2, cy + side_y_offset, page->items[idx_left].icon, OLED_COLOR_NORMAL);
         }
     }
 
-    // ҲͼƬ
+    // 绘制右侧图片
     if (page->item_count > 1) {
         if (page->items[idx_right].icon) {
             OLED_DrawImage(86, cy + side_y_offset, page->items[idx_right].icon, OLED_COLOR_NORMAL);
         }
     }
     
-    // мͼƬ ()
+    // 绘制中间图片 (覆盖两侧)
     OLED_DrawFilledRectangle(cx - 2, cy, IMG_W + 4, IMG_H, OLED_COLOR_REVERSED); 
     
     if (page->items[idx_center].icon) {
         OLED_DrawImage(cx, cy, page->items[idx_center].icon, OLED_COLOR_NORMAL);
     } else {
-        // ͼ
+        // 无图替代框
         OLED_DrawRectangle(cx, cy, IMG_W, IMG_H, OLED_COLOR_NORMAL);
         OLED_PrintASCIIString(cx + 4, cy + 16, "NoIcon", &afont8x6, OLED_COLOR_NORMAL);
     }
 
-    // --- 5. ѡп (Ľ) ---
-    uint8_t bx = cx - 2;
-    uint8_t by = cy - 2;
-    uint8_t bw = IMG_W + 4;
-    uint8_t bh = IMG_H + 4;
-    uint8_t len = 6;
-
-    // Ͻ
-    OLED_DrawLine(bx, by, bx + len, by, OLED_COLOR_NORMAL);
-    OLED_DrawLine(bx, by, bx, by + len, OLED_COLOR_NORMAL);
-    // Ͻ
-    OLED_DrawLine(bx + bw, by, bx + bw - len, by, OLED_COLOR_NORMAL);
-    OLED_DrawLine(bx + bw, by, bx + bw, by + len, OLED_COLOR_NORMAL);
-    // ½
-    OLED_DrawLine(bx, by + bh, bx + len, by + bh, OLED_COLOR_NORMAL);
-    OLED_DrawLine(bx, by + bh, bx, by + bh - len, OLED_COLOR_NORMAL);
-    // ½
-    OLED_DrawLine(bx + bw, by + bh, bx + bw - len, by + bh, OLED_COLOR_NORMAL);
-    OLED_DrawLine(bx + bw, by + bh, bx + bw, by + bh - len, OLED_COLOR_NORMAL);
+    // --- 5. 绘制选中框 (四角, 预渲染后叠加) ---
+    OLED_DrawCanvas(CAROUSEL_FRAME_X, 0, Carousel_GetFrame(), OLED_ROP_OR);
 
-    OLED_ShowFrame();
+    OLED_ShowFrameAsync();
 }
 
 
-// --- ˵ ---
+// --- 菜单导航引擎 ---
 void Menu_Process_Navigate(void) {
     MenuPage *page = g_menu.current_page;
     if (!page) return;
 
-    // Ƿб⣬̬һҳʾ (б3Уޱ4)
+    // 根据是否有标题，动态决定一页能显示几行 (有标题3行，无标题4行)
     uint8_t max_lines = (page->title) ? 3 : 4;
 
     // =======================================================
-    //  KEY3: Previous ( /  / һ)
+    //  KEY3: Previous (向上 / 左 / 上一项)
     // =======================================================
     if (Key_IsSingleClick(KEY3_ID)) { 
         if (page->layout == LAYOUT_CAROUSEL) {
-            // [ֲģʽ]ѭݼ
+            // [轮播模式]：循环递减
             if (g_menu.cursor_pos == 0) g_menu.cursor_pos = page->item_count - 1;
             else g_menu.cursor_pos--;
         } else {
-            // [бģʽ]ͨݼ
+            // [列表模式]：普通递减
             if (g_menu.cursor_pos > 0) {
-                // 1. ƶ
+                // 1. 正常向上移动
                 g_menu.cursor_pos--;
-                // 2. ܵͼϷͼȥ ()
+                // 2. 如果光标跑到了视图上方，视图跟上去 (滚动)
                 if (g_menu.cursor_pos < g_menu.view_offset) {
                     g_menu.view_offset--;
                 }
             } else {
-                // 3. ڶ -> ѭײ
+                // 3. 在顶部继续按上 -> 循环到底部
                 g_menu.cursor_pos = page->item_count - 1; 
-                // ײʱͼƫ
+                // 计算底部时的视图偏移
                 if (page->item_count > max_lines) {
                     g_menu.view_offset = page->item_count - max_lines;
                 } else {
@@ -319,23 +318,23 @@ void Menu_Process_Navigate(void) {
     }
 
     // =======================================================
-    //  KEY1: Next ( /  / һ)
+    //  KEY1: Next (向下 / 右 / 下一项)
     // =======================================================
     if (Key_IsSingleClick(KEY1_ID)) { 
         if (page->layout == LAYOUT_CAROUSEL) {
-             // [ֲģʽ]ѭ
+             // [轮播模式]：循环递增
             g_menu.cursor_pos = (g_menu.cursor_pos + 1) % page->item_count;
         } else {
-            // [бģʽ]
+            // [列表模式]
             if (g_menu.cursor_pos < page->item_count - 1) {
-                // 1. ƶ
+                // 1. 正常向下移动
                 g_menu.cursor_pos++;
-                // 2. ܵͼ·ͼ ()
+                // 2. 如果光标跑到了视图下方，视图跟下来 (滚动)
                 if (g_menu.cursor_pos >= g_menu.view_offset + max_lines) {
                     g_menu.view_offset++;
                 }
             } else {
-                // 3. ڵײ -> ѭ
+                // 3. 在底部继续按下 -> 循环到顶部
                 g_menu.cursor_pos = 0; 
                 g_menu.view_offset = 0;
             }
@@ -343,24 +342,24 @@ void Menu_Process_Navigate(void) {
     }
 
     // =======================================================
-    //  KEY2: Enter (ȷ / )
+    //  KEY2: Enter (确认 / 进入)
     // =======================================================
     if (Key_IsSingleClick(KEY2_ID)) {
         const MenuItem *item = &page->items[g_menu.cursor_pos];
         
         if (item->next_page) {
-            // Ӳ˵
+            // 进入子菜单
             g_menu.current_page = item->next_page;
             g_menu.cursor_pos = 0;
             g_menu.view_offset = 0;
         } else if (item->run_app) {
-            //  APP
+            // 运行 APP
             Menu_SwitchToApp(item->run_app);
         }
     }
 }
 
-// --- ѭ ---
+// --- 主循环 ---
 static uint16_t last_tick = 0;
 
 void Menu_Init(void) {
@@ -368,7 +367,7 @@ void Menu_Init(void) {
 }
 
 void Menu_Loop(void) {
-    // 1. ȫʱ (ԭ߼)
+    // 1. 全局时间更新 (保留你原来的逻辑)
     if (HAL_GetTick() - last_tick >= 1000) {
         last_tick = HAL_GetTick();
         Clock_UpdateTime();
@@ -376,30 +375,30 @@ void Menu_Loop(void) {
    uint8_t h, m, s;
     Clock_GetTimeValues(&h, &m, &s);
     
-    // Ƿ񴥷
-    // ע⣺Tools_CheckAlarm ڲҪзֹ1ظ߼(¼last_min)
+    // 检测闹钟是否触发
+    // 注意：Tools_CheckAlarm 内部需要有防止1分钟内重复触发的逻辑(例如记录last_min)
     if (Tools_CheckAlarm(h, m)) {
-        // ۵ǰڿ顢Ϸãǿת
+        // 无论当前在看电子书、玩游戏还是在设置，强制跳转到响铃界面
         Menu_SwitchToApp(App_Alarm_Ring_Loop);
     }
     Menu_Check_PowerKey();
-    // 2. ״̬
+    // 2. 状态机分流
     switch (g_menu.mode) {
         case SYS_MODE_APP:
-            // еǰAPP (ҳֵͲMPU)
+            // 运行当前的APP (主页、手电筒、MPU等)
             if (g_menu.current_app) g_menu.current_app();
             break;
 
         case SYS_MODE_MENU:
             Menu_Process_Navigate();
-            // ݲѡƺ
+            // 根据布局选择绘制函数
             if (g_menu.current_page->layout == LAYOUT_CAROUSEL) {
                 Menu_Draw_Carousel();
             } else {
                 Menu_Draw_GenericList();
             }
             break;
-        case SYS_MODE_POWER_POPUP: // ״̬
+        case SYS_MODE_POWER_POPUP: // 【新增状态处理】
             Menu_Process_PowerPopup();
             Menu_Draw_PowerPopup();
             break;
@@ -407,40 +406,40 @@ void Menu_Loop(void) {
 }
 
 /**
- * @brief һ˵ (书)
+ * @brief 返回上一级菜单 (带光标记忆功能)
  */
 void Menu_NavigateBack(void) {
-    // ֻдڸ˵ʱŷ
+    // 只有存在父级菜单时才返回
     if (g_menu.current_page && g_menu.current_page->parent) {
         
-        MenuPage *child = g_menu.current_page;      // ǰҳ ()
-        MenuPage *parent = child->parent;           // һ (ְ)
+        MenuPage *child = g_menu.current_page;      // 当前页 (儿子)
+        MenuPage *parent = child->parent;           // 上一级 (爸爸)
 
-        // 1. лظ˵
+        // 1. 切换回父菜单
         g_menu.current_page = parent;
 
-        // 2. [޸] ܲҹλ
-        // ˵ҵ˭ǴӲ˵
-        g_menu.cursor_pos = 0; // ĬϹ(¼)
+        // 2. [核心修改] 智能查找光标位置
+        // 遍历父菜单的所有项，找到是谁把我们带进子菜单的
+        g_menu.cursor_pos = 0; // 默认归零(防备忘录)
         
         for (uint8_t i = 0; i < parent->item_count; i++) {
             if (parent->items[i].next_page == child) {
-                // ҵˣӦͣ
+                // 找到了！光标应该停在这里
                 g_menu.cursor_pos = i; 
                 break;
             }
         }
         uint8_t max_lines = (parent->title) ? 3 : 4;
 
-        // 3. [޸] λ (view_offset)
-        // ں棬ͼܳĻ
+        // 3. [核心修改] 修正滚动条位置 (view_offset)
+        // 如果光标在很下面，必须把视图滚动下来，否则光标会跑出屏幕
        if (g_menu.cursor_pos >= max_lines) {
             g_menu.view_offset = g_menu.cursor_pos - max_lines + 1;
         } else {
             g_menu.view_offset = 0;
         }
 
-        // 4. лز˵ģʽ
+        // 4. 切回菜单模式
         Menu_SwitchToMenu(); 
     }
 }
\ No newline at end of file
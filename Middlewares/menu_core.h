@@ -2,62 +2,62 @@
 #define __MENU_CORE_H
 
 #include <stdint.h>
-#include "oled.h" // Ҫ Image ṹ嶨
-// --- Ͷ ---
+#include "oled.h" // 需要引用 Image 结构体定义
+// --- 类型定义 ---
 void Menu_NavigateBack(void);
-// Ӧóѭָ (ҳֵͲMPUʾȶ)
+// 应用程序循环函数指针 (用于主页、手电筒、MPU显示等独立界面)
 typedef void (*AppLoopCallback)(void);
 
-// ǰ
+// 前向声明
 struct MenuPage;
 
 
 typedef enum {
-    LAYOUT_LIST,    // ֱͨб
-    LAYOUT_CAROUSEL // ͼƬֲ (Cover Flow)
+    LAYOUT_LIST,    // 普通垂直列表
+    LAYOUT_CAROUSEL // 图片轮播 (Cover Flow)
 } PageLayout;
 
-// ˵ṹ
+// 菜单项结构体
 typedef struct {
-    const char *name;           // ˵
+    const char *name;           // 菜单项名字
     const Image *icon;
-    struct MenuPage *next_page; // Ӳ˵ָ (УȷϽ)
-    AppLoopCallback run_app;    // Ӧóָ (Уȷ)
+    struct MenuPage *next_page; // 子菜单指针 (如果有，按确认进入)
+    AppLoopCallback run_app;    // 应用程序指针 (如果有，按确认运行)
 } MenuItem;
 
-// ˵ҳṹ
+// 菜单页结构体
 typedef struct MenuPage {
-    const char *title;          // 
-    const MenuItem *items;      // ˵
-    uint8_t item_count;         // 
-    struct MenuPage *parent;    // ˵ (ڷ)
+    const char *title;          // 标题
+    const MenuItem *items;      // 菜单项数组
+    uint8_t item_count;         // 数量
+    struct MenuPage *parent;    // 父菜单 (用于返回)
     PageLayout layout; 
 } MenuPage;
 
-// --- ϵͳģʽö ---
+// --- 系统模式枚举 ---
 typedef enum {
-    SYS_MODE_MENU,  // ͨò˵
-    SYS_MODE_APP,    // жAPP (ҳֵͲͼ)
-    SYS_MODE_POWER_POPUP,  // ػȷϵģʽ
+    SYS_MODE_MENU,  // 正在浏览通用菜单
+    SYS_MODE_APP,    // 正在运行独立APP (主页、手电筒、看图等)
+    SYS_MODE_POWER_POPUP,  // 【新增】关机确认弹窗模式
 } SystemMode;
 
-// --- Ŀƿ ---
+// --- 核心控制块 ---
 typedef struct {
-    SystemMode mode;            // ǰģʽ
-    MenuPage *current_page;     // [˵ģʽ] ǰ˵ҳ
-    uint8_t cursor_pos;         // [˵ģʽ] λ
-    uint8_t view_offset;        // [˵ģʽ] ƫ
+    SystemMode mode;            // 当前模式
+    MenuPage *current_page;     // [菜单模式] 当前菜单页
+    uint8_t cursor_pos;         // [菜单模式] 光标位置
+    uint8_t view_offset;        // [菜单模式] 滚动偏移
     
-    AppLoopCallback current_app;// [APPģʽ] ǰеAPP
+    AppLoopCallback current_app;// [APP模式] 当前运行的APP函数
     SystemMode last_mode;       
 
 } MenuCtrl;
 
-// --- ⲿӿ ---
+// --- 外部接口 ---
 void Menu_Init(void);
 void Menu_Loop(void);
 
-//  data.c õл
+// 供 data.c 调用的切换函数
 void Menu_SwitchToApp(AppLoopCallback app_func);
 void Menu_SwitchToMenu(void);
 void Menu_NavigateBack(void);
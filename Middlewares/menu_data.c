@@ -1,5 +1,6 @@
 #include "menu_core.h"
 #include "oled.h"
+#include "text_layout.h"
 #include "key.h"
 #include "clock.h"
 #include "mpu6050.h"
@@ -7,16 +8,16 @@
 #include <string.h>
 #include "app_setting.h"
 #include "app_timer.h"
-#include "game.h" // Ϸģ
-#include "battery.h" // <--- Ҫȡ
+#include "game.h" // 引用游戏模块
+#include "battery.h" // <--- 新增：需要读取电量
 #include "app_gradienter.h"
 #include "app_mp3.h"
 #include "app_flashlight.h"
 #include "app_dino.h"
 #include "app_about.h"
-#include "app_message.h" // ǵðͷļ
+#include "app_message.h" // 记得包含头文件
 
-// ⲿͼƬ (ֹδ)
+// 引用外部图片 (防止未定义错误)
 extern const Image Genshin_Impact; 
 extern const Image musicImg;
 extern const Image clockImg;
@@ -28,7 +29,7 @@ extern const Image exitImg;
 extern const Image mihayouImg;
 extern const Image yuanshenImg;
 extern const Image flashlightImg;
-// --- 1. ˵ҳ ---
+// --- 1. 声明菜单页 ---
 extern MenuPage Page_Main;
 extern MenuPage Page_Fellow;  
 
@@ -36,51 +37,51 @@ extern MenuPage Page_Fellow;
 extern MenuPage Page_Setting;
 extern MenuPage Page_DateTime;
 extern MenuPage Page_TimeSet;
-// --- 2. Ӧó (APP) ߼ ---
+// --- 2. 定义应用程序 (APP) 逻辑 ---
 
-// 
-extern MenuPage Page_BadDay; // ǰ BadDay һ˵ҳ
+// 声明
+extern MenuPage Page_BadDay; // 这次我们把 BadDay 改造成一个菜单页
 extern MenuPage Page_Game;
 
 
 
-// [APP 1] ҳ (ʱӽ)
+// [APP 1] 主页 (时钟界面)
 static uint8_t home_cursor = 0; // 0:Flashlight, 1:Menu
 
 
 static const MenuItem Items_Game[] = {
     {"<<",         NULL, NULL,           Menu_NavigateBack},
-    {"˹",     NULL, NULL,           App_Tetris_Loop}, // ˹
-    {"ȸС",       NULL, NULL,           App_Dino_Loop},   // 
+    {"俄罗斯方块",     NULL, NULL,           App_Tetris_Loop}, // 俄罗斯方块
+    {"谷歌小恐龙",       NULL, NULL,           App_Dino_Loop},   // 恐龙快跑
 };
 
-// бֵӲ˵
+// 列表布局的子菜单
 MenuPage Page_Game = { "Games", Items_Game, 3, &Page_Main, LAYOUT_LIST };
 
 
-// 3. Setting ˵ (Date & Time, ...)
+// 3. Setting 主菜单 (Date & Time, 其他...)
 static const MenuItem Items_Setting[] = {
     {"<<",          NULL, NULL,            Menu_NavigateBack},
-    {"Date & Time", NULL, &Page_DateTime,  NULL},            // DateTimeӲ˵
-    {"Sleep Time",  NULL, NULL,            App_Set_Sleep_Loop}, // <--- һ
-    {"System",      NULL, NULL,            App_System_Info_Loop},            // Ԥ
-    {"Sound",       NULL, NULL,            App_Set_Sound_Loop},            // Ԥ
-    {"Brightness",  NULL, NULL,            App_Set_Brightness_Loop}, // 
+    {"Date & Time", NULL, &Page_DateTime,  NULL},            // 进入DateTime子菜单
+    {"Sleep Time",  NULL, NULL,            App_Set_Sleep_Loop}, // <--- 新增这一行
+    {"System",      NULL, NULL,            App_System_Info_Loop},            // 预留
+    {"Sound",       NULL, NULL,            App_Set_Sound_Loop},            // 预留
+    {"Brightness",  NULL, NULL,            App_Set_Brightness_Loop}, // 亮度
 };
 MenuPage Page_Setting = { "Settings", Items_Setting, 6, &Page_Main, LAYOUT_LIST };
 
-// 2. Date & Time Ӳ˵ (Date, Time)
+// 2. Date & Time 子菜单 (Date, Time)
 static const MenuItem Items_DateTime[] = {
     {"<<",         NULL, NULL,           Menu_NavigateBack},
-    {"Date",       NULL, NULL,           App_Set_Date_Loop},  // APP
-    {"Time",       NULL, &Page_TimeSet,  NULL},               // TimeSetӲ˵
+    {"Date",       NULL, NULL,           App_Set_Date_Loop},  // 进入日期设置APP
+    {"Time",       NULL, &Page_TimeSet,  NULL},               // 进入TimeSet子菜单
 };
 MenuPage Page_DateTime = { "Date&Time", Items_DateTime, 3, &Page_Setting, LAYOUT_LIST };
 
 static const MenuItem Items_TimeSet[] = {
     {"<<",         NULL, NULL,           Menu_NavigateBack},
-    {"Set Value",  NULL, NULL,           App_Set_Time_Loop},  // ʱAPP
-    {"12H/24H",    NULL, NULL,           App_Toggle_Format},  // лʽ
+    {"Set Value",  NULL, NULL,           App_Set_Time_Loop},  // 进入时间设置APP
+    {"12H/24H",    NULL, NULL,           App_Toggle_Format},  // 切换格式
 };
 MenuPage Page_TimeSet = { "Time Opts", Items_TimeSet, 3, &Page_DateTime, LAYOUT_LIST };
 
@@ -95,53 +96,53 @@ MenuPage Page_TimeSet = { "Time Opts", Items_TimeSet, 3, &Page_DateTime, LAYOUT_
 
 
 /**
- * @brief ſ (л)
+ * @brief 播放开机动画 (呼吸渐变切换)
  */
 void Menu_PlayBootAnimation(void)
 {
-    // 1. ȰΪ 0 (ȫ)׼͵͵ͼ
+    // 1. 先把亮度设为 0 (全黑)，准备偷偷绘图
     OLED_SetBrightness(0);
     
-    // ----------------- һͼ -----------------
+    // ----------------- 第一张图 -----------------
     
-    // 2. Ƶһͼ (ʱĻǺڵģû)
+    // 2. 绘制第一张图 (此时屏幕是黑的，用户看不见过程)
     OLED_NewFrame();
     OLED_DrawImage(0, 0, &mihayouImg, OLED_COLOR_NORMAL);
     OLED_ShowFrame();
     
-    // 3.  (Fade In)
-    // Ϊ5ٶСͰ i+=5 Ĵdelay С
+    // 3. 渐亮 (Fade In)
+    // 步长为5，速度适中。如果嫌慢就把 i+=5 改大，delay 改小
     for (int i = 0; i <= 255; i += 5) {
         OLED_SetBrightness(i);
         HAL_Delay(10); 
     }
     
-    // 4. ָչʾ 1.5
+    // 4. 保持高亮展示 1.5秒
     HAL_Delay(1500);
     
-    // 5.  (Fade Out)
+    // 5. 渐灭 (Fade Out)
     for (int i = 255; i >= 0; i -= 5) {
         OLED_SetBrightness(i);
         HAL_Delay(10);
     }
     
-    // ----------------- ڶͼ -----------------
+    // ----------------- 第二张图 -----------------
     
-    // 6. ʱΪ0͵͵ɵڶͼ
+    // 6. 此时亮度为0，偷偷换成第二张图
     OLED_NewFrame();
     OLED_DrawImage(0, 0, &yuanshenImg, OLED_COLOR_NORMAL);
     OLED_ShowFrame();
     
-    // 7. ٴν (Fade In)
+    // 7. 再次渐亮 (Fade In)
     for (int i = 0; i <= 255; i += 5) {
         OLED_SetBrightness(i);
         HAL_Delay(10);
     }
     
-    // 8. չʾ 1.5
+    // 8. 保持展示 1.5秒
     HAL_Delay(1500);
     
-    // 9. Ϊ 255 ʹ
+    // 9. 动画结束，保持亮度为 255 给主界面使用
     OLED_SetBrightness(255);
 }
 
@@ -149,74 +150,75 @@ void Menu_PlayBootAnimation(void)
 
 
 // ============================================================================
-//   [APP 1] ҳ (Home Screen) - 
+//   [APP 1] 主页 (Home Screen) - 二级交互版
 // ============================================================================
 void App_Home_Loop(void) {
-    // ״̬0=޽(Ĭ), 1=˵ťн
+    // 状态变量：0=无焦点(默认), 1=菜单按钮有焦点
     static uint8_t home_focus = 0; 
-    // ʱڹԶʧ
+    // 计时器：用于光标自动消失
     static uint32_t last_input_tick = 0;
 
-    // --- 1. ߼ ---
+    // --- 1. 逻辑处理 ---
     
-    // 괦ڼ״̬ҳ3޲Զȡ
+    // 如果光标处于激活状态，且超过3秒无操作，自动取消光标
     if (home_focus == 1 && (HAL_GetTick() - last_input_tick > 3000)) {
         home_focus = 0; 
     }
 
     if (home_focus == 0) {
-        // [״̬ A: ޽]
-        //  (KEY1/2/3)ǻѹ
+        // [状态 A: 无焦点]
+        // 按下任意键 (KEY1/2/3)，仅仅是唤醒光标
         if (Key_IsSingleClick(KEY1_ID) || Key_IsSingleClick(KEY2_ID) || Key_IsSingleClick(KEY3_ID)) {
             home_focus = 1;
-            last_input_tick = HAL_GetTick(); // ¼ʱ
+            last_input_tick = HAL_GetTick(); // 记录时间
         }
     } 
     else {
-        // [״̬ B: Ѿ۽ "˵"]
-        // ֻа KEY2 (ȷϼ) Ż˵
+        // [状态 B: 已聚焦 "菜单"]
+        // 只有按下 KEY2 (确认键) 才会进入菜单
         if (Key_IsSingleClick(KEY2_ID)) {
-            home_focus = 0; // ״̬´λ޽
+            home_focus = 0; // 重置状态，下次回来还是无焦点
             Menu_SwitchToMenu();
             return;
         }
         
-        //  KEY1  KEY3һʱ䣬ֹʧ
-        // (൱άָ)
+        // 如果按了 KEY1 或 KEY3，更新一下时间，防止光标消失，但不做其他动作
+        // (相当于维持高亮)
         if (Key_IsSingleClick(KEY1_ID) || Key_IsSingleClick(KEY3_ID)) {
             last_input_tick = HAL_GetTick();
         }
     }
 
-    // --- 2.  ---
+    // --- 2. 界面绘制 ---
      OLED_NewFrame();
     const Clock_Display_t *dt = Clock_GetDisplayTime();
     int battery_pct = Battery_Get_Percentage();
 
     // ==========================================================
-    // A. ʱ (޸Ĳ֡)
+    // A. 中央时间 (【核心修改部分】)
     // ==========================================================
     if (Clock_GetFormat() == TIME_FMT_24H) {
-        // [24H ģʽ]ԭľʾ
-        // X = (128 - 96) / 2 = 16
-        OLED_PrintASCIIString(16, 20, (char*)dt->time_str, &afont24x12, OLED_COLOR_NORMAL);
+        // [24H 模式]：保持原来的居中显示
+        // afont24x12 是比例字体 (数字等宽), 按实际宽度居中
+        uint8_t time_w = Text_Measure(dt->time_str, &afont24x12, 0);
+        OLED_PrintASCIIString((128 - time_w) / 2, 20, (char*)dt->time_str, &afont24x12, OLED_COLOR_NORMAL);
     } 
     else {
-        // [12H ģʽ]ʱƣұ߷ AM/PM
-        // ԣʱ X=4, AM/PM  X=104 (4ؼ)
+        // [12H 模式]：时间左移，右边放 AM/PM
+        // 策略：时间放 X=4, AM/PM 放 X=104 (留4像素间隔)
         
-        // 1. ʱ (8ַ * 12ؿ = 96)
+        // 1. 画时间 (8个字符, 比例字体共82像素宽)
         OLED_PrintASCIIString(4, 20, (char*)dt->time_str, &afont24x12, OLED_COLOR_NORMAL);
         
-        // 2.  AM/PM (ʹе afont12x6)
-        // 12Ϊ˺ʹ(24)ĵײ룬YҪ㣺
-        // ֵײ Y = 20 + 24 = 44
+        // 2. 画 AM/PM (使用中等字体 afont12x6)
+        // 字体高12，为了和大字(高24)的底部对齐，Y坐标需要计算：
+        // 大字底部 Y = 20 + 24 = 44
         // AM/PM Y = 44 - 12 = 32
         const char* ampm = dt->is_pm ? "PM" : "AM";
         OLED_PrintASCIIString(104, 32, (char*)ampm, &afont12x6, OLED_COLOR_NORMAL);
     }
 
-    // B. Ͻǵ
+    // B. 右上角电量
     char bat_buf[5];
     sprintf(bat_buf, "%d%%", battery_pct);
     OLED_PrintASCIIString(0, 54, bat_buf, &afont8x6, OLED_COLOR_NORMAL);
@@ -230,42 +232,41 @@ void App_Home_Loop(void) {
         OLED_DrawFilledRectangle(bat_x + 1, bat_y + 1, fill_w, bat_h - 2, OLED_COLOR_NORMAL);
     }
 
-    // C. ½
+    // C. 左下角日期
     OLED_PrintASCIIString(10, 0, (char*)dt->date_str, &afont12x6, OLED_COLOR_NORMAL);
     OLED_PrintASCIIString(100, 0, (char*)dt->week_str, &afont12x6, OLED_COLOR_NORMAL);
 
-    // 2. ʾ (һ)
-    // Ա
-    // ռ 10*6 = 60 أ 4 ؼ
-    // D. ½ǣ˵ ( focus ״̬ıʾʽ)
+    // 2. 【新增】显示星期 (星期一)
+    // 放在日期旁边
+    // 日期占 10*6 = 60 像素，留 4 像素间隔
+    // D. 右下角：“菜单” (根据 focus 状态改变显示样式)
     if (home_focus == 1) {
-        // [н]׵׺ (ɫ)
-        OLED_DrawFilledRectangle(96, 48, 32, 16, OLED_COLOR_NORMAL); // ׿
-        OLED_ShowGBK(96, 48, "˵", 16, OLED_COLOR_REVERSED); // д
+        // [有焦点]：白底黑字 (反色)
+        OLED_DrawFilledRectangle(96, 48, 32, 16, OLED_COLOR_NORMAL); // 画白框
+        OLED_ShowGBK(96, 48, "菜单", 16, OLED_COLOR_REVERSED); // 写黑字
     } else {
-        // [޽]ڵװ ()
-        // OLED_DrawFilledRectangle(96, 48, 32, 16, OLED_COLOR_REVERSED); // ѡ
-        OLED_ShowGBK(96, 48, "˵", 16, OLED_COLOR_NORMAL); // д
+        // [无焦点]：黑底白字 (正常)
+        // OLED_DrawFilledRectangle(96, 48, 32, 16, OLED_COLOR_REVERSED); // 可选：清空区域
+        OLED_ShowGBK(96, 48, "菜单", 16, OLED_COLOR_NORMAL); // 写白字
     }
 
-    OLED_ShowFrame();
+    OLED_ShowFrameAsync();
 }
 
-// [APP 2] ֵͲ
+// [APP 2] 手电筒
 void App_Flashlight_Loop(void) {
     if (Key_IsSingleClick(KEY1_ID) || Key_IsSingleClick(KEY2_ID) || Key_IsSingleClick(KEY3_ID)) {
-        Menu_SwitchToApp(App_Home_Loop); // ҳ
+        Menu_SwitchToApp(App_Home_Loop); // 返回主页
         return;
     }
-    extern uint8_t OLED_GRAM[8][128];
-    memset(OLED_GRAM, 0xFF, sizeof(OLED_GRAM)); // ȫ
+    OLED_FillArea(0, 0, 128, 64, OLED_COLOR_NORMAL); // 全白
     OLED_ShowFrame();
 }
 
-// [APP 3] MPU6050 ʾ
+// [APP 3] MPU6050 显示
 void App_MPU6050_Loop(void) {
     if (Key_IsSingleClick(KEY2_ID)) {
-        Menu_SwitchToMenu(); // ز˵
+        Menu_SwitchToMenu(); // 返回菜单
         return;
     }
     
@@ -281,10 +282,10 @@ void App_MPU6050_Loop(void) {
     OLED_ShowFrame();
 }
 
-// [APP 4] Bad Day (ͼ)
+// [APP 4] Bad Day (看图)
 void App_BadDay_Loop(void) {
     if (Key_IsSingleClick(KEY2_ID)) {
-        Menu_SwitchToMenu(); // ز˵
+        Menu_SwitchToMenu(); // 返回菜单
         return;
     }
     OLED_NewFrame();
@@ -292,7 +293,7 @@ void App_BadDay_Loop(void) {
     OLED_ShowFrame();
 }
 
-// [APP 5] ͨҳ (ʾ)
+// [APP 5] 通用详情页 (演示用)
 void App_Detail_Generic(void) {
     if (Key_IsSingleClick(KEY2_ID)) { Menu_SwitchToMenu(); return; }
     OLED_NewFrame();
@@ -302,32 +303,32 @@ void App_Detail_Generic(void) {
 }
 
 
-// --- 3. ˵ṹ (ĺ) ---
+// --- 3. 定义菜单结构 (数据驱动的核心) ---
 
-// ˵
+// 主菜单的内容
 static const MenuItem Items_Main[] = {
-    //            // ͼָ       // Ӳ˵       // APP
-    {"˳",           &exitImg,    NULL,          App_Home_Loop},    // һǷ
-    {"ˮƽ",      &balanceImg,       NULL,          App_Gradienter_Loop},
-    {"",      &clockImg,       &Page_BadDay,           NULL},     
-    {"Ϣ",       &messageImg,    &Page_Fellow,  NULL},             // Ӳ˵
-    {"",        &musicImg,     NULL,          App_MP3_Loop},
-    {"",      &settingImg,     &Page_Setting,          NULL},
-    {"Ϸ",         &gameImg,        &Page_Game,    NULL},               // ޸һУָӲ˵
-    {"ֵͲ",       &flashlightImg, NULL,          App_FlashlightLoop}, 
+    // 名字           // 图标指针       // 子菜单       // APP
+    {"退出",           &exitImg,    NULL,          App_Home_Loop},    // 第一项是返回
+    {"水平仪",      &balanceImg,       NULL,          App_Gradienter_Loop},
+    {"闹钟",      &clockImg,       &Page_BadDay,           NULL},     
+    {"信息",       &messageImg,    &Page_Fellow,  NULL},             // 进子菜单
+    {"音乐",        &musicImg,     NULL,          App_MP3_Loop},
+    {"设置",      &settingImg,     &Page_Setting,          NULL},
+    {"游戏",         &gameImg,        &Page_Game,    NULL},               // 修改这一行：指向子菜单
+    {"手电筒",       &flashlightImg, NULL,          App_FlashlightLoop}, 
 };
 
-//  Fellow Ӳ˵
+// 定义 Fellow 的子菜单项
 static const MenuItem Items_Fellow[] = {
-    // бģʽ icon  NULL
+    // 列表模式下 icon 可以填 NULL
     {"<<",       NULL, NULL,              Menu_NavigateBack}, 
-    {"", NULL, NULL,              App_About_Loop},
-    {"", NULL, NULL,              App_Message_Loop},
+    {"作者", NULL, NULL,              App_About_Loop},
+    {"关于我", NULL, NULL,              App_Message_Loop},
 };
 
 
 
-// ˵ҳ
+// 构建主菜单页
 MenuPage Page_Main = { 
     .title = "Main Menu", 
     .items = Items_Main, 
@@ -336,29 +337,29 @@ MenuPage Page_Main = {
     .layout = LAYOUT_CAROUSEL
 };
 
-//  Fellow ҳ (ע parent ָ Page_Main)
+// 定义 Fellow 页面 (注意 parent 指向 Page_Main)
 MenuPage Page_Fellow = { 
     "Fellow Menu",
      Items_Fellow, 3, 
      &Page_Main 
 };
-// --- ʼ ---
-//  core.c ãóʼ״̬
+// --- 初始化入口 ---
+// 供 core.c 调用，设置初始状态
 
 
-// Ӳ˵
+// 定义子菜单项
 static const MenuItem Items_BadDay[] = {
     {"<<",         NULL, NULL,           Menu_NavigateBack},
-    {"",      NULL, NULL,           App_Alarm_Set_Loop},    // 
-    {"ʱ",  NULL, NULL,           App_Stopwatch_Loop},    // 
+    {"闹钟",      NULL, NULL,           App_Alarm_Set_Loop},    // 闹钟
+    {"计时器",  NULL, NULL,           App_Stopwatch_Loop},    // 秒表
 };
 
-// ҳ (б)
+// 定义页面 (列表布局)
 MenuPage Page_BadDay = { "Tools Box", Items_BadDay, 3, &Page_Main, LAYOUT_LIST };
 
 
 void Menu_LoadInitialState(MenuCtrl *ctrl) {
     ctrl->mode = SYS_MODE_APP;
-    ctrl->current_app = App_Home_Loop; // ĬϽҳ
-    ctrl->current_page = &Page_Main;   // Ĭϲ˵Main
+    ctrl->current_app = App_Home_Loop; // 默认进主页
+    ctrl->current_page = &Page_Main;   // 默认菜单是Main
 }
\ No newline at end of file
@@ -1,17 +1,51 @@
 #include "sys_params.h"
 #include "w25qxx.h"
+#include "flash_job.h"
+#include "crc32.h"
 #include "oled.h"
 #include "mp3_player.h"
 #include "app_timer.h"
 #include "app_power.h"
 #include <string.h> // for memset
 
-// ȫֲʵ
+// 全局参数实例
 SysParams_t g_sys_params;
 
-// --- ڲУ ---
-// 򵥵ۼУ飬ֹ
+// 参数记录 (日志式存储): 每次保存在扇区中追加一条完整的记录, 不擦除
+// 开机时扫描所有扇区, 取序号最大且CRC正确的一条; 当前扇区写满时擦除下一个扇区继续写
+// 掉电时最多丢失正在写的那一条, 之前的记录都还在
+typedef struct {
+    uint32_t seq;          // 序号, 越大越新
+    SysParams_t params;
+    uint32_t crc;          // seq + params 的 CRC32
+    uint8_t  reserved[PARAM_RECORD_SIZE - sizeof(uint32_t) - sizeof(SysParams_t) - sizeof(uint32_t)];
+} ParamRecord_t;
+
+#define PARAM_RECORDS_PER_SECTOR (4096 / PARAM_RECORD_SIZE)
+
+static const uint32_t s_param_sectors[] = PARAM_FLASH_SECTORS;
+#define PARAM_SECTOR_COUNT (sizeof(s_param_sectors) / sizeof(s_param_sectors[0]))
+
+static uint8_t  s_sector = 0;      // 正在写的扇区
+static uint16_t s_next_slot = 0;   // 下一条记录的位置
+static uint32_t s_seq = 0;         // 最新记录的序号
+
+// 后台保存用的副本 (写入完成前 g_sys_params 可能又被修改)
+static ParamRecord_t s_save_buf;
+static uint8_t s_save_busy = 0;    // 正在后台保存
+static uint8_t s_save_again = 0;   // 保存期间参数又改了, 完成后再保存一次
+static uint8_t s_save_retry = 0;   // 校验失败后的重试次数
+#define PARAM_SAVE_RETRY 2
+
+// --- 内部函数：计算校验和 ---
+// CRC32 (不含最后的 checksum 字段), 能发现字节交换、互相抵消等累加和查不出的错误
 static uint32_t Calc_Checksum(SysParams_t *p) {
+    return Crc32(p, sizeof(SysParams_t) - sizeof(uint32_t));
+}
+
+// --- 内部函数：旧版本的累加校验和 ---
+// 只用于读取旧版本直接存在扇区开头的参数
+static uint32_t Legacy_Checksum(SysParams_t *p) {
     uint32_t sum = 0;
     uint8_t *ptr = (uint8_t*)p;
     uint32_t len = sizeof(SysParams_t) - sizeof(uint32_t);
@@ -22,74 +56,165 @@ static uint32_t Calc_Checksum(SysParams_t *p) {
     return sum;
 }
 
-// --- ڲĬֵ ---
-//  Flash Ϊջʱ
+static uint32_t Record_CRC(const ParamRecord_t *r) {
+    return Crc32(r, sizeof(uint32_t) + sizeof(SysParams_t));
+}
+
+// --- 内部函数：扫描所有扇区, 找出最新的有效记录 ---
+// 每个扇区一次连续读取; 全为0xFF的位置是空位, 记录按顺序追加, 最后一条非空记录之后就是下一条的位置
+// 返回 1:找到 (结果在 *out) 0:没有有效记录
+static uint8_t Params_Scan(ParamRecord_t *out) {
+    ParamRecord_t rec;
+    uint8_t found = 0;
+    uint16_t used[PARAM_SECTOR_COUNT];
+    
+    for (uint8_t s = 0; s < PARAM_SECTOR_COUNT; s++) {
+        used[s] = 0;
+        W25Q_ReadStart(s_param_sectors[s]);
+        for (uint16_t i = 0; i < PARAM_RECORDS_PER_SECTOR; i++) {
+            const uint8_t *p = (const uint8_t*)&rec;
+            uint8_t empty = 1;
+            
+            W25Q_ReadContinue((uint8_t*)&rec, PARAM_RECORD_SIZE);
+            for (uint8_t j = 0; j < PARAM_RECORD_SIZE; j++) {
+                if (p[j] != 0xFF) { empty = 0; break; }
+            }
+            if (empty) continue;
+            used[s] = i + 1; // 写了一半(CRC错误)的位置也不能再写
+            
+            if (rec.seq != 0xFFFFFFFF && rec.crc == Record_CRC(&rec) &&
+                (!found || rec.seq > out->seq)) {
+                *out = rec;
+                s_sector = s;
+                found = 1;
+            }
+        }
+        W25Q_ReadStop();
+    }
+    
+    if (found) {
+        s_seq = out->seq;
+        s_next_slot = used[s_sector];
+    } else {
+        // 没有记录: 从第一个扇区中已用部分之后开始写 (旧版本把参数直接存在第一个扇区开头)
+        s_sector = 0;
+        s_next_slot = used[0];
+    }
+    return found;
+}
+
+// --- 内部函数：加载默认值 ---
+// 当 Flash 为空或数据损坏时调用
 static void Load_Defaults(void) {
     g_sys_params.magic = PARAM_MAGIC_NUM;
     
-    // Ĭϲ
-    g_sys_params.volume_mute = 0;      // Ĭ
-    g_sys_params.brightness  = 255;    // Ĭ
-    g_sys_params.sleep_time  = 10000;  // Ĭ10Ϣ
-    // Ĭֵ (7:00, ر)
+    // 设置你的默认参数
+    g_sys_params.volume_mute = 0;      // 默认有声
+    g_sys_params.brightness  = 255;    // 默认最亮
+    g_sys_params.sleep_time  = 10000;  // 默认10秒息屏
+    // 【新增】闹钟默认值 (7:00, 关闭)
     g_sys_params.alarm_h = 7;
     g_sys_params.alarm_m = 0;
     g_sys_params.alarm_on = 0; 
     
-    // У
+    // 计算校验和
     g_sys_params.checksum = Calc_Checksum(&g_sys_params);
 }
 
-// --- ڲӦòӲ ---
-// ṹֵӦõģ
+// --- 内部函数：应用参数到硬件 ---
+// 将结构体里的值应用到各个驱动模块
 static void Apply_Params(void) {
-    // 1. Ӧ
+    // 1. 应用亮度
     OLED_SetBrightness(g_sys_params.brightness);
     
-    // 2. Ӧþ״̬
-    // ע⣺Ҫ bool  uint8_t תһ£Ȼ C ͨͨ
+    // 2. 应用静音状态
+    // 注意：这里需要把 bool 和 uint8_t 转换一下，虽然 C 里通常通用
     MP3_SetMuteStatus((bool)g_sys_params.volume_mute);
     
-    // 3. ӦϢʱ
+    // 3. 应用息屏时间
     Power_SetTimeout(g_sys_params.sleep_time);
     Tools_SetAlarm(g_sys_params.alarm_h, 
                    g_sys_params.alarm_m, 
                    (bool)g_sys_params.alarm_on);
 }
 
-// ================= ӿ =================
+// ================= 公共接口 =================
 
-// ʼ
+// 开机初始化
 void System_Params_Init(void) {
-    // 1.  Flash ȡṹ
-    W25Q_Read((uint8_t*)&g_sys_params, PARAM_FLASH_ADDR, sizeof(SysParams_t));
-    
-    // 2. ֤Ч
-    uint32_t cal_sum = Calc_Checksum(&g_sys_params);
+    ParamRecord_t rec;
     
-    if (g_sys_params.magic != PARAM_MAGIC_NUM || g_sys_params.checksum != cal_sum) {
-        // Чһο𻵣Ĭֵ
-        Load_Defaults();
-        System_Params_Save(); // д Flash
+    // 1. 扫描参数记录, 取最新的一条
+    if (Params_Scan(&rec) && rec.params.magic == PARAM_MAGIC_NUM) {
+        g_sys_params = rec.params;
+    } else {
+        // 2. 没有记录时尝试旧版本的格式 (第一个扇区开头的一个结构体)
+        W25Q_Read((uint8_t*)&g_sys_params, s_param_sectors[0], sizeof(SysParams_t));
+        uint32_t cal_sum = Legacy_Checksum(&g_sys_params);
+        
+        if (g_sys_params.magic != PARAM_MAGIC_NUM || g_sys_params.checksum != cal_sum) {
+            // 数据无效（第一次开机或损坏），加载默认值
+            Load_Defaults();
+        }
+        System_Params_Save(); // 写入一条记录
     }
     
-    // 3. Ӧò
+    // 3. 应用参数
     Apply_Params();
 }
 
-//  Flash
+// --- 内部函数：把一条新记录排入后台写入队列 ---
+// 写入 -> 校验, 由主循环中的 FlashJob_Task 推进; 当前扇区写满时先擦除下一个扇区
+static void Params_Save_Done(void *ctx, uint8_t ok);
+
+static void Params_Queue_Save(void) {
+    uint32_t addr;
+    
+    if (FlashJob_Free() < 3) FlashJob_Flush(); // 队列满了只能等一等
+
+    if (s_next_slot >= PARAM_RECORDS_PER_SECTOR) {
+        // 换到下一个扇区: 旧扇区中的记录在新记录写好之前一直有效
+        s_sector = (s_sector + 1) % PARAM_SECTOR_COUNT;
+        s_next_slot = 0;
+        FlashJob_Erase(s_param_sectors[s_sector], NULL, NULL);
+    }
+    addr = s_param_sectors[s_sector] + s_next_slot * PARAM_RECORD_SIZE;
+    s_next_slot++; // 即使写入失败这个位置也不再使用
+    
+    memset(&s_save_buf, 0xFF, sizeof(s_save_buf));
+    s_save_buf.seq = ++s_seq;
+    s_save_buf.params = g_sys_params;
+    s_save_buf.crc = Record_CRC(&s_save_buf);
+    
+    s_save_busy = 1;
+    s_save_again = 0;
+    FlashJob_Program(addr, (const uint8_t*)&s_save_buf, sizeof(ParamRecord_t), NULL, NULL);
+    FlashJob_Verify(addr, (const uint8_t*)&s_save_buf, sizeof(ParamRecord_t), Params_Save_Done, NULL);
+}
+
+static void Params_Save_Done(void *ctx, uint8_t ok) {
+    (void)ctx;
+    s_save_busy = 0;
+    if (!ok && s_save_retry < PARAM_SAVE_RETRY) {
+        s_save_retry++;
+        Params_Queue_Save(); // 写到下一个位置
+        return;
+    }
+    s_save_retry = 0;
+    if (s_save_again) Params_Queue_Save();
+}
+
+// 保存参数到 Flash (后台进行, 立即返回)
+// 只追加一条记录 (写一页中的32字节), 大约每128次保存才擦除一次扇区
 void System_Params_Save(void) {
-    // 1. У
+    // 1. 更新校验和
     g_sys_params.checksum = Calc_Checksum(&g_sys_params);
     
-    // 2.  (Flash дǰСλͨ 4KB )
-    // ע⣺ PARAM_FLASH_ADDR ʼ 4KB 
-    // ֻһṹ壬ԶС 4KBǰȫ
-    W25Q_Erase_Sector(PARAM_FLASH_ADDR);
-    
-    // 3. д
-    W25Q_Write_NoCheck((uint8_t*)&g_sys_params, PARAM_FLASH_ADDR, sizeof(SysParams_t));
+    // 2. 追加一条记录
+    // 上一次保存还没完成时, 等它完成后再保存一次最新的值
+    if (s_save_busy) s_save_again = 1;
+    else Params_Queue_Save();
     
-    // 4. 󣬽˳Ӧһ£ֹֻ˲ûӦã
+    // 3. 保存后，建议顺便应用一下（防止调用者只改了参数没应用）
     Apply_Params();
 }
\ No newline at end of file
@@ -1,23 +1,23 @@
 #include "battery.h"
 
-// CubeMXɵADCΪ hadc1
+// 假设你的CubeMX生成的ADC句柄名为 hadc1
 extern ADC_HandleTypeDef hadc1;
 
-// --- ú궨 ---
-#define BATTERY_ADC_SAMPLES       100      // ADC
-#define ADC_VREF                  3.3f     // ADCοѹ
-#define ADC_MAX_VALUE             4095.0f  // 12λADCֵ
+// --- 配置宏定义 ---
+#define BATTERY_ADC_SAMPLES       100      // ADC采样次数
+#define ADC_VREF                  3.3f     // ADC参考电压
+#define ADC_MAX_VALUE             4095.0f  // 12位ADC的最大值
 
 
 // ===================================================================================
-// !!! У׼ !!!
-// ʵʲֵ
-#define BATTERY_ADC_MIN           2000     // 0% (յ) ӦADCֵ
-#define BATTERY_ADC_MAX           2500     // 100% () ӦADCֵ
+// !!! 最终校准参数 !!!
+// 根据你的实际测量值进行配置
+#define BATTERY_ADC_MIN           2000     // 0%电量 (空电) 对应的ADC值
+#define BATTERY_ADC_MAX           2500     // 100%电量 (满电) 对应的ADC值
 // ===================================================================================
 
 
-// --- BAT_ADC_EN Ŷ ---
+// --- BAT_ADC_EN 引脚定义 ---
 #ifndef BAT_ADC_EN_GPIO_Port
 #define BAT_ADC_EN_GPIO_Port      GPIOB
 #endif
@@ -27,7 +27,7 @@ extern ADC_HandleTypeDef hadc1;
 
 
 /**
- * @brief  ʼؼģ
+ * @brief  初始化电池检测模块
  */
 void Battery_Init(void)
 {
@@ -35,7 +35,7 @@ void Battery_Init(void)
 }
 
 /**
- * @brief  ȡصѹӦADCԭʼƽֵ
+ * @brief  获取电池电压对应的ADC原始平均值
  */
 uint16_t Battery_Get_ADC_Value(void)
 {
@@ -52,7 +52,7 @@ uint16_t Battery_Get_ADC_Value(void)
 }
 
 /**
- * @brief  ȡĵصѹֵ (ע: ˵ѹΪPA0ŵѹʵصѹ)
+ * @brief  获取计算后的电池电压值 (注意: 此电压为PA0引脚电压，非真实电池电压)
  */
 float Battery_Get_Voltage(void)
 {
@@ -61,28 +61,28 @@ float Battery_Get_Voltage(void)
 }
 
 /**
- * @brief  ȡĵصٷֱ (ʹУ׼ֵ)
+ * @brief  获取计算后的电池电量百分比 (使用最终校准值)
  */
 int Battery_Get_Percentage(void)
 {
     uint16_t adc_value = Battery_Get_ADC_Value();
     long percentage;
 
-    // ߽紦1ǰֵ趨Сֵ (2000)Ϊ 0%
+    // 边界处理1：如果当前值低于设定的最小值 (2000)，则电量为 0%
     if (adc_value < BATTERY_ADC_MIN)
     {
         return 0;
     }
 
-    // ߽紦2ǰֵ趨ֵ (2500)Ϊ 100%
-    // ߼ش˵ "嵽2510ҲҪ100%" 
+    // 边界处理2：如果当前值高于设定的最大值 (2500)，则电量为 100%
+    // 这个逻辑完美地处理了你说的 "冲到2510也要算100%" 的情况
     if (adc_value >= BATTERY_ADC_MAX)
     {
         return 100;
     }
     
-    // ļ㹫ʽ [2000, 2500] ڽӳ
-    // (ǰֵ - Сֵ) * 100 / (ֵ - Сֵ)
+    // 核心计算公式：在 [2000, 2500] 区间内进行线性映射
+    // (当前值 - 最小值) * 100 / (最大值 - 最小值)
     percentage = (long)(adc_value - BATTERY_ADC_MIN) * 100 / (BATTERY_ADC_MAX - BATTERY_ADC_MIN);
 
     return (int)percentage;
@@ -0,0 +1,94 @@
+/**
+ * @file crc32.c
+ * @brief CRC32 (与zlib.crc32相同), 用于参数记录、字库和说明书的完整性校验
+ * @note STM32上用硬件CRC单元: 每个32位字一次写入, 比软件快很多.
+ *       硬件CRC是不反转的CRC-32/MPEG-2 (每次从0xFFFFFFFF开始, 先处理最高位),
+ *       zlib的CRC32是按位反转的. 输入字和结果都用RBIT反转一下, 两者就相同了.
+ * @note 硬件CRC的寄存器只能复位成0xFFFFFFFF, 不能直接写入中间值. 分段计算时先把上一段的结果
+ *       反推成一个输入字(Crc32_LoadWord), 复位后写入这个字, 寄存器就恢复到上一段结束时的值.
+ * @note 主机(PC)上没有CRC单元 (没有定义CRC), 用查表法计算, 结果相同.
+ *       不是4字节对齐的开头和结尾几个字节也用查表法.
+ */
+#include "crc32.h"
+#include "main.h"
+
+#if defined(CRC) && !defined(CRC32_NO_HW)
+#define CRC32_USE_HW 1
+#else
+#define CRC32_USE_HW 0
+#endif
+
+// 半字节(4位)查表, 表只占64字节
+static const uint32_t Crc32_Table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+/**
+ * @brief 查表法处理一段数据 (crc为取反后的中间值)
+ */
+static uint32_t Crc32_Soft(uint32_t crc, const uint8_t *p, uint32_t len)
+{
+  while (len--)
+  {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ Crc32_Table[crc & 0x0F];
+    crc = (crc >> 4) ^ Crc32_Table[crc & 0x0F];
+  }
+  return crc;
+}
+
+#if CRC32_USE_HW
+/**
+ * @brief 求一个输入字: 硬件CRC复位后写入它, 寄存器的值变为 reg
+ * @note 硬件每写入一个字: 寄存器先与这个字异或, 再移位32次 (最高位为1时异或多项式0x04C11DB7).
+ *       多项式最低位为1, 所以每一步都可以反推: 最低位为1说明移出的最高位是1.
+ */
+static uint32_t Crc32_LoadWord(uint32_t reg)
+{
+  for (uint8_t i = 0; i < 32; i++)
+    reg = (reg & 1) ? ((reg ^ 0x04C11DB7) >> 1) | 0x80000000 : reg >> 1;
+  return reg ^ 0xFFFFFFFF;
+}
+#endif
+
+/**
+ * @brief 计算CRC32, 可以分段 (第一段crc传0, 之后传上一段的结果)
+ */
+uint32_t Crc32_Update(uint32_t crc, const void *data, uint32_t len)
+{
+  const uint8_t *p = (const uint8_t *)data;
+
+  crc = ~crc;
+#if CRC32_USE_HW
+  // 开头不是4字节对齐的部分
+  while (len && ((uintptr_t)p & 3))
+  {
+    crc = Crc32_Soft(crc, p++, 1);
+    len--;
+  }
+  if (len >= 4)
+  {
+    const uint32_t *w = (const uint32_t *)p;
+
+    __HAL_RCC_CRC_CLK_ENABLE();
+    CRC->CR = CRC_CR_RESET;
+    if (crc != 0xFFFFFFFF)
+      CRC->DR = Crc32_LoadWord(__RBIT(crc));
+    for (; len >= 4; len -= 4)
+      CRC->DR = __RBIT(*w++);
+    crc = __RBIT(CRC->DR);
+    p = (const uint8_t *)w;
+  }
+#endif
+  crc = Crc32_Soft(crc, p, len);
+  return ~crc;
+}
+
+/**
+ * @brief 计算一段数据的CRC32
+ */
+uint32_t Crc32(const void *data, uint32_t len)
+{
+  return Crc32_Update(0, data, len);
+}
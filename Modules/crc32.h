@@ -0,0 +1,11 @@
+#ifndef __CRC32_H__
+#define __CRC32_H__
+
+#include "stdint.h"
+
+// CRC32, 与zlib.crc32相同 (多项式0xEDB88320, 初值和结果取反)
+// 分段计算: crc = Crc32_Update(0, 第一段); crc = Crc32_Update(crc, 下一段); ...
+uint32_t Crc32_Update(uint32_t crc, const void *data, uint32_t len);
+uint32_t Crc32(const void *data, uint32_t len);
+
+#endif // __CRC32_H__
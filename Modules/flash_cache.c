@@ -0,0 +1,170 @@
+/**
+ * @file flash_cache.c
+ * @brief W25Q_Read前面的小块读缓存
+ * @note 很多界面每帧都读同样的几段Flash: 手册阅读器每轮读3行文字, 计算行数时每32字节读2个字节.
+ *       每次读取都要发命令和地址, 数据越短开销占比越大. 这里把最近读过的256字节(一页)留在RAM中,
+ *       按LRU淘汰. 只缓存短读取 (小于一行), 图片等大块数据直接从Flash读, 不会把缓存冲掉.
+ *       汉字点阵、写入后的校验等不会重复读的数据用W25Q_ReadDirect读, 也不经过这里.
+ * @note 顺序预读: 缺失的行紧接在上一次访问的行后面时, 认为是在顺序读取,
+ *       把这一行和下一行用一次连续读取一起读进来.
+ * @note 一致性: 擦除/写入开始和完成时w25qxx调用FlashCache_Invalidate, 去掉对应地址的行.
+ */
+#include "flash_cache.h"
+#include "w25qxx.h"
+#include <string.h>
+
+#if FLASH_CACHE_LINES > 0
+
+#define FLASH_CACHE_NONE 0 // 空行
+
+static uint8_t FlashCache_Data[FLASH_CACHE_LINES][FLASH_CACHE_LINE_SIZE];
+static uint32_t FlashCache_Tag[FLASH_CACHE_LINES]; // 行号 + 1 (行号 = 地址 / 行大小), 0表示空行
+static uint32_t FlashCache_Stamp[FLASH_CACHE_LINES]; // 最近一次使用的时间, 淘汰最小的
+static uint32_t FlashCache_Clock;
+static uint32_t FlashCache_LastLine = FLASH_CACHE_NONE; // 上一次访问的行号 + 1
+
+static uint32_t FlashCache_Hits;
+static uint32_t FlashCache_Misses;
+static uint32_t FlashCache_Saved; // 直接从缓存返回、不用从Flash读的字节数
+
+/**
+ * @brief 查找行, 没有时返回-1
+ */
+static int8_t FlashCache_Find(uint32_t line)
+{
+  for (uint8_t i = 0; i < FLASH_CACHE_LINES; i++)
+  {
+    if (FlashCache_Tag[i] == line + 1)
+      return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief 找一个可以替换的行 (空行或最久没用的行), 不替换keep
+ */
+static uint8_t FlashCache_Victim(int8_t keep)
+{
+  uint8_t victim = (keep == 0) ? 1 : 0;
+
+  for (uint8_t i = 0; i < FLASH_CACHE_LINES; i++)
+  {
+    if (i == keep)
+      continue;
+    if (FlashCache_Tag[i] == FLASH_CACHE_NONE)
+      return i;
+    if (FlashCache_Stamp[i] < FlashCache_Stamp[victim])
+      victim = i;
+  }
+  return victim;
+}
+
+/**
+ * @brief 读入一行; 顺序访问时把下一行也一起读入
+ */
+static uint8_t FlashCache_Fill(uint32_t line)
+{
+  uint8_t i = FlashCache_Victim(-1);
+  int8_t next = -1;
+
+  FlashCache_Tag[i] = line + 1;
+  FlashCache_Stamp[i] = ++FlashCache_Clock;
+
+  W25Q_ReadStart(line * FLASH_CACHE_LINE_SIZE);
+  W25Q_ReadContinue(FlashCache_Data[i], FLASH_CACHE_LINE_SIZE);
+  // 上一次访问的是前一行 (FlashCache_LastLine 为前一行的行号 + 1)
+  if (FLASH_CACHE_LINES > 1 && FlashCache_LastLine != FLASH_CACHE_NONE && FlashCache_LastLine == line &&
+      FlashCache_Find(line + 1) < 0)
+  {
+    next = FlashCache_Victim(i);
+    FlashCache_Tag[next] = line + 2;
+    FlashCache_Stamp[next] = FlashCache_Clock; // 比当前行旧, 没被用到时先被淘汰
+    W25Q_ReadContinue(FlashCache_Data[next], FLASH_CACHE_LINE_SIZE);
+  }
+  W25Q_ReadStop();
+  return i;
+}
+
+/**
+ * @brief 通过缓存读取
+ * @return 1:已读出 0:不适合缓存 (长读取), 调用者直接从Flash读
+ */
+uint8_t FlashCache_Read(uint8_t *buf, uint32_t addr, uint32_t len)
+{
+  if (buf == NULL || len == 0 || len >= FLASH_CACHE_LINE_SIZE)
+    return 0;
+
+  while (len)
+  {
+    uint32_t line = addr / FLASH_CACHE_LINE_SIZE;
+    uint16_t offset = addr % FLASH_CACHE_LINE_SIZE;
+    uint16_t n = FLASH_CACHE_LINE_SIZE - offset;
+    int8_t i = FlashCache_Find(line);
+
+    if (n > len)
+      n = len;
+    if (i >= 0)
+    {
+      FlashCache_Hits++;
+      FlashCache_Saved += n;
+      FlashCache_Stamp[i] = ++FlashCache_Clock;
+    }
+    else
+    {
+      FlashCache_Misses++;
+      i = FlashCache_Fill(line);
+    }
+    memcpy(buf, FlashCache_Data[i] + offset, n);
+    FlashCache_LastLine = line + 1;
+
+    buf += n;
+    addr += n;
+    len -= n;
+  }
+  return 1;
+}
+
+/**
+ * @brief 去掉与 [addr, addr + len) 重叠的行 (擦除/写入时调用)
+ */
+void FlashCache_Invalidate(uint32_t addr, uint32_t len)
+{
+  uint32_t first = addr / FLASH_CACHE_LINE_SIZE + 1;
+  uint32_t last = (len > 0xFFFFFFFF - addr) ? 0xFFFFFFFF : (addr + len - 1) / FLASH_CACHE_LINE_SIZE + 1;
+
+  if (len == 0)
+    return;
+  for (uint8_t i = 0; i < FLASH_CACHE_LINES; i++)
+  {
+    if (FlashCache_Tag[i] >= first && FlashCache_Tag[i] <= last)
+      FlashCache_Tag[i] = FLASH_CACHE_NONE;
+  }
+  FlashCache_LastLine = FLASH_CACHE_NONE;
+}
+
+#else
+
+uint8_t FlashCache_Read(uint8_t *buf, uint32_t addr, uint32_t len)
+{
+  return 0;
+}
+
+void FlashCache_Invalidate(uint32_t addr, uint32_t len)
+{
+}
+
+#endif // FLASH_CACHE_LINES > 0
+
+/**
+ * @brief 统计: 命中次数(按行计), 缺失次数, 从缓存返回的字节数
+ */
+void FlashCache_GetStats(uint32_t *hits, uint32_t *misses, uint32_t *saved)
+{
+#if FLASH_CACHE_LINES > 0
+  *hits = FlashCache_Hits;
+  *misses = FlashCache_Misses;
+  *saved = FlashCache_Saved;
+#else
+  *hits = *misses = *saved = 0;
+#endif
+}
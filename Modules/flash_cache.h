@@ -0,0 +1,18 @@
+#ifndef __FLASH_CACHE_H__
+#define __FLASH_CACHE_H__
+
+#include "stdint.h"
+
+// 缓存行数 (每行 FLASH_CACHE_LINE_SIZE 字节RAM), 为0时不使用缓存
+#ifndef FLASH_CACHE_LINES
+#define FLASH_CACHE_LINES 4
+#endif
+
+// 缓存行大小, 与W25Q的页大小相同, 行按地址对齐
+#define FLASH_CACHE_LINE_SIZE 256
+
+uint8_t FlashCache_Read(uint8_t *buf, uint32_t addr, uint32_t len);
+void FlashCache_Invalidate(uint32_t addr, uint32_t len);
+void FlashCache_GetStats(uint32_t *hits, uint32_t *misses, uint32_t *saved);
+
+#endif // __FLASH_CACHE_H__
@@ -0,0 +1,178 @@
+/**
+ * @file flash_job.c
+ * @brief 外部Flash的后台擦除/写入队列
+ * @note 擦除一个扇区要几十毫秒, 写一页约1ms, 原来的W25Q_Erase_Sector/W25Q_Write_Page一直等到完成,
+ *       保存设置时界面会卡住. 这里把擦除、写入、校验排成队列, 由主循环调用FlashJob_Task推进:
+ *       每次只发出一条命令(擦除一个扇区或写一页)就返回, 下一轮主循环查询状态寄存器, 完成后再发下一条.
+ * @note 擦除/写入期间界面照常读取字库: W25Q_ReadStart会先暂停擦除/写入, 下一次FlashJob_Task时恢复.
+ * @note 写入和校验的数据在任务完成(回调)之前必须保持不变, 调用者一般用静态缓冲区保存一份副本.
+ */
+#include "flash_job.h"
+#include "w25qxx.h"
+#include <string.h>
+
+typedef struct FlashJob {
+  uint8_t type;
+  const uint8_t *data;
+  uint32_t addr;
+  uint32_t len;
+  uint32_t pos; // 已经完成的字节数 (擦除: 0未开始 1已发出命令)
+  FlashJobCallback cb;
+  void *ctx;
+} FlashJob;
+
+static FlashJob FlashJob_Queue[FLASH_JOB_QUEUE_SIZE];
+static uint8_t FlashJob_Head;
+static uint8_t FlashJob_Count;
+
+/**
+ * @brief 加入队列
+ * @return 1:成功 0:队列已满
+ */
+static uint8_t FlashJob_Push(uint8_t type, uint32_t addr, const uint8_t *data, uint32_t len,
+                             FlashJobCallback cb, void *ctx)
+{
+  FlashJob *job;
+
+  if (FlashJob_Count >= FLASH_JOB_QUEUE_SIZE)
+    return 0;
+  job = &FlashJob_Queue[(FlashJob_Head + FlashJob_Count) % FLASH_JOB_QUEUE_SIZE];
+  job->type = type;
+  job->addr = addr;
+  job->data = data;
+  job->len = len;
+  job->pos = 0;
+  job->cb = cb;
+  job->ctx = ctx;
+  FlashJob_Count++;
+  return 1;
+}
+
+/**
+ * @brief 队首任务完成: 先出队再回调, 回调中可以继续加入新任务
+ */
+static void FlashJob_Finish(uint8_t ok)
+{
+  FlashJob *job = &FlashJob_Queue[FlashJob_Head];
+  FlashJobCallback cb = job->cb;
+  void *ctx = job->ctx;
+
+  FlashJob_Head = (FlashJob_Head + 1) % FLASH_JOB_QUEUE_SIZE;
+  FlashJob_Count--;
+  if (cb)
+    cb(ctx, ok);
+}
+
+/**
+ * @brief 擦除addr所在的扇区
+ * @return 1:已加入队列 0:队列已满
+ */
+uint8_t FlashJob_Erase(uint32_t addr, FlashJobCallback cb, void *ctx)
+{
+  return FlashJob_Push(FLASH_JOB_ERASE, addr & ~0xFFFul, NULL, 0, cb, ctx);
+}
+
+/**
+ * @brief 写入数据 (目标区域需要事先擦除)
+ * @return 1:已加入队列 0:队列已满
+ */
+uint8_t FlashJob_Program(uint32_t addr, const uint8_t *data, uint32_t len, FlashJobCallback cb, void *ctx)
+{
+  return FlashJob_Push(FLASH_JOB_PROGRAM, addr, data, len, cb, ctx);
+}
+
+/**
+ * @brief 读回Flash中的数据与data比较, 结果通过回调的ok返回
+ * @return 1:已加入队列 0:队列已满
+ */
+uint8_t FlashJob_Verify(uint32_t addr, const uint8_t *data, uint32_t len, FlashJobCallback cb, void *ctx)
+{
+  return FlashJob_Push(FLASH_JOB_VERIFY, addr, data, len, cb, ctx);
+}
+
+/**
+ * @brief 队列中剩余的空位
+ */
+uint8_t FlashJob_Free(void)
+{
+  return FLASH_JOB_QUEUE_SIZE - FlashJob_Count;
+}
+
+/**
+ * @brief 还没完成的任务数
+ */
+uint8_t FlashJob_Pending(void)
+{
+  return FlashJob_Count;
+}
+
+/**
+ * @brief 推进队列 (在主循环中调用, 不阻塞)
+ * @note 芯片忙时只读一次状态寄存器就返回; 空闲时发出队首任务的下一条命令
+ */
+void FlashJob_Task(void)
+{
+  FlashJob *job;
+  uint8_t buf[FLASH_JOB_VERIFY_CHUNK];
+  uint32_t n;
+
+  if (W25Q_Poll())
+    return;
+  if (FlashJob_Count == 0)
+    return;
+
+  job = &FlashJob_Queue[FlashJob_Head];
+  switch (job->type)
+  {
+  case FLASH_JOB_ERASE:
+    if (job->pos == 0)
+    {
+      W25Q_Erase_Sector_Start(job->addr);
+      job->pos = 1;
+      return;
+    }
+    FlashJob_Finish(1);
+    break;
+
+  case FLASH_JOB_PROGRAM:
+    if (job->pos < job->len)
+    {
+      n = 256 - ((job->addr + job->pos) & 0xFF); // 当前页剩余字节数
+      if (n > job->len - job->pos)
+        n = job->len - job->pos;
+      W25Q_Write_Page_Start((uint8_t *)job->data + job->pos, job->addr + job->pos, n);
+      job->pos += n;
+      return;
+    }
+    FlashJob_Finish(1);
+    break;
+
+  case FLASH_JOB_VERIFY:
+    n = job->len - job->pos;
+    if (n > sizeof(buf))
+      n = sizeof(buf);
+    W25Q_ReadDirect(buf, job->addr + job->pos, n); // 只读一次, 不经过读缓存
+    if (memcmp(buf, job->data + job->pos, n))
+    {
+      FlashJob_Finish(0);
+      break;
+    }
+    job->pos += n;
+    if (job->pos >= job->len)
+      FlashJob_Finish(1);
+    break;
+  }
+}
+
+/**
+ * @brief 阻塞执行完队列中的全部任务 (关机前、或队列已满又必须写入时使用)
+ */
+void FlashJob_Flush(void)
+{
+  while (FlashJob_Count)
+  {
+    W25Q_Sync();
+    FlashJob_Task();
+  }
+  W25Q_Sync();
+}
@@ -0,0 +1,31 @@
+#ifndef __FLASH_JOB_H__
+#define __FLASH_JOB_H__
+
+#include "stdint.h"
+
+// 队列中最多的任务数
+#ifndef FLASH_JOB_QUEUE_SIZE
+#define FLASH_JOB_QUEUE_SIZE 8
+#endif
+
+// 校验时每次(每轮主循环)读回比较的字节数
+#define FLASH_JOB_VERIFY_CHUNK 64
+
+typedef enum {
+  FLASH_JOB_ERASE,   // 擦除一个扇区 (4KB)
+  FLASH_JOB_PROGRAM, // 写入任意长度 (自动分页, 不擦除)
+  FLASH_JOB_VERIFY,  // 读回与RAM中的数据比较
+} FlashJobType;
+
+// 任务完成时调用 ok: 1成功 0校验不一致
+typedef void (*FlashJobCallback)(void *ctx, uint8_t ok);
+
+uint8_t FlashJob_Erase(uint32_t addr, FlashJobCallback cb, void *ctx);
+uint8_t FlashJob_Program(uint32_t addr, const uint8_t *data, uint32_t len, FlashJobCallback cb, void *ctx);
+uint8_t FlashJob_Verify(uint32_t addr, const uint8_t *data, uint32_t len, FlashJobCallback cb, void *ctx);
+uint8_t FlashJob_Free(void);
+uint8_t FlashJob_Pending(void);
+void FlashJob_Task(void);
+void FlashJob_Flush(void);
+
+#endif // __FLASH_JOB_H__
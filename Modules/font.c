@@ -109,314 +109,449 @@ const unsigned char ascii_8x6[][6] = {
 
 const ASCIIFont afont8x6 = {8, 6, (unsigned char *)ascii_8x6};
 
-const unsigned char ascii_12x6[][12] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*" ",0*/
-    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00}, /*"!",1*/
-    {0x00, 0x0C, 0x02, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*""",2*/
-    {0x90, 0xD0, 0xBC, 0xD0, 0xBC, 0x90, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00}, /*"#",3*/
-    {0x18, 0x24, 0xFE, 0x44, 0x8C, 0x00, 0x03, 0x02, 0x07, 0x02, 0x01, 0x00}, /*"$",4*/
-    {0x18, 0x24, 0xD8, 0xB0, 0x4C, 0x80, 0x00, 0x03, 0x00, 0x01, 0x02, 0x01}, /*"%",5*/
-    {0xC0, 0x38, 0xE4, 0x38, 0xE0, 0x00, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02}, /*"&",6*/
-    {0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"'",7*/
-    {0x00, 0x00, 0x00, 0xF8, 0x04, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04}, /*"(",8*/
-    {0x00, 0x02, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00}, /*")",9*/
-    {0x90, 0x60, 0xF8, 0x60, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00}, /*"*",10*/
-    {0x20, 0x20, 0xFC, 0x20, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00}, /*"+",11*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00}, /*",",12*/
-    {0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"-",13*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00}, /*".",14*/
-    {0x00, 0x80, 0x60, 0x1C, 0x02, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00}, /*"/",15*/
-    {0xF8, 0x04, 0x04, 0x04, 0xF8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"0",16*/
-    {0x00, 0x08, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00}, /*"1",17*/
-    {0x18, 0x84, 0x44, 0x24, 0x18, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x00}, /*"2",18*/
-    {0x08, 0x04, 0x24, 0x24, 0xD8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"3",19*/
-    {0x40, 0xB0, 0x88, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00}, /*"4",20*/
-    {0x3C, 0x24, 0x24, 0x24, 0xC4, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"5",21*/
-    {0xF8, 0x24, 0x24, 0x2C, 0xC0, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"6",22*/
-    {0x0C, 0x04, 0xE4, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00}, /*"7",23*/
-    {0xD8, 0x24, 0x24, 0x24, 0xD8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"8",24*/
-    {0x38, 0x44, 0x44, 0x44, 0xF8, 0x00, 0x00, 0x03, 0x02, 0x02, 0x01, 0x00}, /*"9",25*/
-    {0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00}, /*":",26*/
-    {0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00}, /*";",27*/
-    {0x00, 0x20, 0x50, 0x88, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02}, /*"<",28*/
-    {0x90, 0x90, 0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"=",29*/
-    {0x00, 0x02, 0x04, 0x88, 0x50, 0x20, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00}, /*">",30*/
-    {0x18, 0x04, 0xC4, 0x24, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00}, /*"?",31*/
-    {0xF8, 0x04, 0xE4, 0x94, 0xF8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00}, /*"@",32*/
-    {0x00, 0xE0, 0x9C, 0xF0, 0x80, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02}, /*"A",33*/
-    {0x04, 0xFC, 0x24, 0x24, 0xD8, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x00}, /*"B",34*/
-    {0xF8, 0x04, 0x04, 0x04, 0x0C, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"C",35*/
-    {0x04, 0xFC, 0x04, 0x04, 0xF8, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x00}, /*"D",36*/
-    {0x04, 0xFC, 0x24, 0x74, 0x0C, 0x00, 0x02, 0x03, 0x02, 0x02, 0x03, 0x00}, /*"E",37*/
-    {0x04, 0xFC, 0x24, 0x74, 0x0C, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00}, /*"F",38*/
-    {0xF0, 0x08, 0x04, 0x44, 0xCC, 0x40, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00}, /*"G",39*/
-    {0x04, 0xFC, 0x20, 0x20, 0xFC, 0x04, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02}, /*"H",40*/
-    {0x04, 0x04, 0xFC, 0x04, 0x04, 0x00, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00}, /*"I",41*/
-    {0x00, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x06, 0x04, 0x04, 0x03, 0x00, 0x00}, /*"J",42*/
-    {0x04, 0xFC, 0x24, 0xD0, 0x0C, 0x04, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02}, /*"K",43*/
-    {0x04, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03}, /*"L",44*/
-    {0xFC, 0x3C, 0xC0, 0x3C, 0xFC, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00}, /*"M",45*/
-    {0x04, 0xFC, 0x30, 0xC4, 0xFC, 0x04, 0x02, 0x03, 0x02, 0x00, 0x03, 0x00}, /*"N",46*/
-    {0xF8, 0x04, 0x04, 0x04, 0xF8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"O",47*/
-    {0x04, 0xFC, 0x24, 0x24, 0x18, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00}, /*"P",48*/
-    {0xF8, 0x84, 0x84, 0x04, 0xF8, 0x00, 0x01, 0x02, 0x02, 0x07, 0x05, 0x00}, /*"Q",49*/
-    {0x04, 0xFC, 0x24, 0x64, 0x98, 0x00, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02}, /*"R",50*/
-    {0x18, 0x24, 0x24, 0x44, 0x8C, 0x00, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00}, /*"S",51*/
-    {0x0C, 0x04, 0xFC, 0x04, 0x0C, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00}, /*"T",52*/
-    {0x04, 0xFC, 0x00, 0x00, 0xFC, 0x04, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00}, /*"U",53*/
-    {0x04, 0x7C, 0x80, 0xE0, 0x1C, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00}, /*"V",54*/
-    {0x1C, 0xE0, 0x3C, 0xE0, 0x1C, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00}, /*"W",55*/
-    {0x04, 0x9C, 0x60, 0x9C, 0x04, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00}, /*"X",56*/
-    {0x04, 0x1C, 0xE0, 0x1C, 0x04, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00}, /*"Y",57*/
-    {0x0C, 0x84, 0x64, 0x1C, 0x04, 0x00, 0x02, 0x03, 0x02, 0x02, 0x03, 0x00}, /*"Z",58*/
-    {0x00, 0x00, 0xFE, 0x02, 0x02, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x00}, /*"[",59*/
-    {0x00, 0x0E, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00}, /*"\",60*/
-    {0x00, 0x02, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x04, 0x07, 0x00, 0x00}, /*"]",61*/
-    {0x00, 0x04, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"^",62*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08}, /*"_",63*/
-    {0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"`",64*/
-    {0x00, 0x40, 0xA0, 0xA0, 0xC0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x02}, /*"a",65*/
-    {0x04, 0xFC, 0x20, 0x20, 0xC0, 0x00, 0x00, 0x03, 0x02, 0x02, 0x01, 0x00}, /*"b",66*/
-    {0x00, 0xC0, 0x20, 0x20, 0x60, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00}, /*"c",67*/
-    {0x00, 0xC0, 0x20, 0x24, 0xFC, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x02}, /*"d",68*/
-    {0x00, 0xC0, 0xA0, 0xA0, 0xC0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00}, /*"e",69*/
-    {0x00, 0x20, 0xF8, 0x24, 0x24, 0x04, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00}, /*"f",70*/
-    {0x00, 0x40, 0xA0, 0xA0, 0x60, 0x20, 0x00, 0x07, 0x0A, 0x0A, 0x0A, 0x04}, /*"g",71*/
-    {0x04, 0xFC, 0x20, 0x20, 0xC0, 0x00, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02}, /*"h",72*/
-    {0x00, 0x20, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00}, /*"i",73*/
-    {0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00}, /*"j",74*/
-    {0x04, 0xFC, 0x80, 0xE0, 0x20, 0x20, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02}, /*"k",75*/
-    {0x04, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00}, /*"l",76*/
-    {0xE0, 0x20, 0xE0, 0x20, 0xC0, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00}, /*"m",77*/
-    {0x20, 0xE0, 0x20, 0x20, 0xC0, 0x00, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02}, /*"n",78*/
-    {0x00, 0xC0, 0x20, 0x20, 0xC0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00}, /*"o",79*/
-    {0x20, 0xE0, 0x20, 0x20, 0xC0, 0x00, 0x08, 0x0F, 0x0A, 0x02, 0x01, 0x00}, /*"p",80*/
-    {0x00, 0xC0, 0x20, 0x20, 0xE0, 0x00, 0x00, 0x01, 0x02, 0x0A, 0x0F, 0x08}, /*"q",81*/
-    {0x20, 0xE0, 0x40, 0x20, 0x20, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00}, /*"r",82*/
-    {0x00, 0x60, 0xA0, 0xA0, 0x20, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x00}, /*"s",83*/
-    {0x00, 0x20, 0xF8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00}, /*"t",84*/
-    {0x20, 0xE0, 0x00, 0x20, 0xE0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x02}, /*"u",85*/
-    {0x20, 0xE0, 0x20, 0x80, 0x60, 0x20, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00}, /*"v",86*/
-    {0x60, 0x80, 0xE0, 0x80, 0x60, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00}, /*"w",87*/
-    {0x20, 0x60, 0x80, 0x60, 0x20, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00}, /*"x",88*/
-    {0x20, 0xE0, 0x20, 0x80, 0x60, 0x20, 0x08, 0x08, 0x07, 0x01, 0x00, 0x00}, /*"y",89*/
-    {0x00, 0x20, 0xA0, 0x60, 0x20, 0x00, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00}, /*"z",90*/
-    {0x00, 0x00, 0x20, 0xDE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00}, /*"{",91*/
-    {0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00}, /*"|",92*/
-    {0x00, 0x02, 0xDE, 0x20, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00}, /*"}",93*/
-    {0x02, 0x01, 0x02, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"~",94*/
+// glyph_pack.py: afont12x6 begin
+// 压缩字体 由 scripts/font_converter/glyph_pack.py 从 ascii_12x6.c 生成, 请勿手工修改
+const unsigned char ascii_12x6_packed[] = {
+    0x00, 0x00, /*" ",0*/
+    0x04, 0x01, 0xFC, 0x02, /*"!",1*/
+    0x1E, 0x00, 0x0C, 0x02, 0x0C, 0x02, /*""",2*/
+    0xBF, 0x02, 0x90, 0xD0, 0xBC, 0xD0, 0xBC, 0x90, 0x03, 0x03, /*"#",3*/
+    0xDF, 0x07, 0x18, 0x24, 0xFE, 0x44, 0x8C, 0x03, 0x02, 0x07, 0x02, 0x01, /*"$",4*/
+    0xBF, 0x0E, 0x18, 0x24, 0xD8, 0xB0, 0x4C, 0x80, 0x03, 0x01, 0x02, 0x01, /*"%",5*/
+    0xDF, 0x0F, 0xC0, 0x38, 0xE4, 0x38, 0xE0, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, /*"&",6*/
+    0x03, 0x00, 0x08, 0x06, /*"'",7*/
+    0x38, 0x0E, 0xF8, 0x04, 0x02, 0x01, 0x02, 0x04, /*"(",8*/
+    0x8E, 0x03, 0x02, 0x04, 0xF8, 0x04, 0x02, 0x01, /*")",9*/
+    0x1F, 0x01, 0x90, 0x60, 0xF8, 0x60, 0x90, 0x01, /*"*",10*/
+    0x1F, 0x01, 0x20, 0x20, 0xFC, 0x20, 0x20, 0x01, /*"+",11*/
+    0xC0, 0x00, 0x08, 0x06, /*",",12*/
+    0x1F, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, /*"-",13*/
+    0x80, 0x00, 0x02, /*".",14*/
+    0xDE, 0x00, 0x80, 0x60, 0x1C, 0x02, 0x04, 0x03, /*"/",15*/
+    0xDF, 0x07, 0xF8, 0x04, 0x04, 0x04, 0xF8, 0x01, 0x02, 0x02, 0x02, 0x01, /*"0",16*/
+    0x86, 0x03, 0x08, 0xFC, 0x02, 0x03, 0x02, /*"1",17*/
+    0xDF, 0x07, 0x18, 0x84, 0x44, 0x24, 0x18, 0x03, 0x02, 0x02, 0x02, 0x02, /*"2",18*/
+    0xDF, 0x07, 0x08, 0x04, 0x24, 0x24, 0xD8, 0x01, 0x02, 0x02, 0x02, 0x01, /*"3",19*/
+    0x1F, 0x06, 0x40, 0xB0, 0x88, 0xFC, 0x80, 0x03, 0x02, /*"4",20*/
+    0xDF, 0x07, 0x3C, 0x24, 0x24, 0x24, 0xC4, 0x01, 0x02, 0x02, 0x02, 0x01, /*"5",21*/
+    0xDF, 0x07, 0xF8, 0x24, 0x24, 0x2C, 0xC0, 0x01, 0x02, 0x02, 0x02, 0x01, /*"6",22*/
+    0x1F, 0x01, 0x0C, 0x04, 0xE4, 0x1C, 0x04, 0x03, /*"7",23*/
+    0xDF, 0x07, 0xD8, 0x24, 0x24, 0x24, 0xD8, 0x01, 0x02, 0x02, 0x02, 0x01, /*"8",24*/
+    0x9F, 0x07, 0x38, 0x44, 0x44, 0x44, 0xF8, 0x03, 0x02, 0x02, 0x01, /*"9",25*/
+    0x04, 0x01, 0x10, 0x02, /*":",26*/
+    0x04, 0x01, 0x20, 0x06, /*";",27*/
+    0x3E, 0x0C, 0x20, 0x50, 0x88, 0x04, 0x02, 0x01, 0x02, /*"<",28*/
+    0x1F, 0x00, 0x90, 0x90, 0x90, 0x90, 0x90, /*"=",29*/
+    0xBE, 0x01, 0x02, 0x04, 0x88, 0x50, 0x20, 0x02, 0x01, /*">",30*/
+    0x1F, 0x01, 0x18, 0x04, 0xC4, 0x24, 0x18, 0x02, /*"?",31*/
+    0xDF, 0x07, 0xF8, 0x04, 0xE4, 0x94, 0xF8, 0x01, 0x02, 0x02, 0x02, 0x02, /*"@",32*/
+    0xDE, 0x0C, 0xE0, 0x9C, 0xF0, 0x80, 0x02, 0x03, 0x03, 0x02, /*"A",33*/
+    0xDF, 0x07, 0x04, 0xFC, 0x24, 0x24, 0xD8, 0x02, 0x03, 0x02, 0x02, 0x01, /*"B",34*/
+    0xDF, 0x07, 0xF8, 0x04, 0x04, 0x04, 0x0C, 0x01, 0x02, 0x02, 0x02, 0x01, /*"C",35*/
+    0xDF, 0x07, 0x04, 0xFC, 0x04, 0x04, 0xF8, 0x02, 0x03, 0x02, 0x02, 0x01, /*"D",36*/
+    0xDF, 0x07, 0x04, 0xFC, 0x24, 0x74, 0x0C, 0x02, 0x03, 0x02, 0x02, 0x03, /*"E",37*/
+    0xDF, 0x01, 0x04, 0xFC, 0x24, 0x74, 0x0C, 0x02, 0x03, 0x02, /*"F",38*/
+    0xBF, 0x07, 0xF0, 0x08, 0x04, 0x44, 0xCC, 0x40, 0x01, 0x02, 0x02, 0x01, /*"G",39*/
+    0xFF, 0x0C, 0x04, 0xFC, 0x20, 0x20, 0xFC, 0x04, 0x02, 0x03, 0x03, 0x02, /*"H",40*/
+    0xDF, 0x07, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x02, 0x02, 0x03, 0x02, 0x02, /*"I",41*/
+    0xFE, 0x03, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x06, 0x04, 0x04, 0x03, /*"J",42*/
+    0xFF, 0x0D, 0x04, 0xFC, 0x24, 0xD0, 0x0C, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, /*"K",43*/
+    0xC7, 0x0F, 0x04, 0xFC, 0x04, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, /*"L",44*/
+    0x5F, 0x05, 0xFC, 0x3C, 0xC0, 0x3C, 0xFC, 0x03, 0x03, 0x03, /*"M",45*/
+    0xFF, 0x05, 0x04, 0xFC, 0x30, 0xC4, 0xFC, 0x04, 0x02, 0x03, 0x02, 0x03, /*"N",46*/
+    0xDF, 0x07, 0xF8, 0x04, 0x04, 0x04, 0xF8, 0x01, 0x02, 0x02, 0x02, 0x01, /*"O",47*/
+    0xDF, 0x01, 0x04, 0xFC, 0x24, 0x24, 0x18, 0x02, 0x03, 0x02, /*"P",48*/
+    0xDF, 0x07, 0xF8, 0x84, 0x84, 0x04, 0xF8, 0x01, 0x02, 0x02, 0x07, 0x05, /*"Q",49*/
+    0xDF, 0x0D, 0x04, 0xFC, 0x24, 0x64, 0x98, 0x02, 0x03, 0x02, 0x03, 0x02, /*"R",50*/
+    0xDF, 0x07, 0x18, 0x24, 0x24, 0x44, 0x8C, 0x03, 0x02, 0x02, 0x02, 0x01, /*"S",51*/
+    0x9F, 0x03, 0x0C, 0x04, 0xFC, 0x04, 0x0C, 0x02, 0x03, 0x02, /*"T",52*/
+    0xB3, 0x07, 0x04, 0xFC, 0xFC, 0x04, 0x01, 0x02, 0x02, 0x01, /*"U",53*/
+    0x3F, 0x01, 0x04, 0x7C, 0x80, 0xE0, 0x1C, 0x04, 0x03, /*"V",54*/
+    0x9F, 0x02, 0x1C, 0xE0, 0x3C, 0xE0, 0x1C, 0x03, 0x03, /*"W",55*/
+    0xDF, 0x06, 0x04, 0x9C, 0x60, 0x9C, 0x04, 0x02, 0x03, 0x03, 0x02, /*"X",56*/
+    0x9F, 0x03, 0x04, 0x1C, 0xE0, 0x1C, 0x04, 0x02, 0x03, 0x02, /*"Y",57*/
+    0xDF, 0x07, 0x0C, 0x84, 0x64, 0x1C, 0x04, 0x02, 0x03, 0x02, 0x02, 0x03, /*"Z",58*/
+    0x1C, 0x07, 0xFE, 0x02, 0x02, 0x07, 0x04, 0x04, /*"[",59*/
+    0x0E, 0x06, 0x0E, 0x30, 0xC0, 0x01, 0x02, /*"\",60*/
+    0x8E, 0x03, 0x02, 0x02, 0xFE, 0x04, 0x04, 0x07, /*"]",61*/
+    0x0E, 0x00, 0x04, 0x02, 0x04, /*"^",62*/
+    0xC0, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, /*"_",63*/
+    0x04, 0x00, 0x02, /*"`",64*/
+    0x9E, 0x0F, 0x40, 0xA0, 0xA0, 0xC0, 0x01, 0x02, 0x02, 0x03, 0x02, /*"a",65*/
+    0x9F, 0x07, 0x04, 0xFC, 0x20, 0x20, 0xC0, 0x03, 0x02, 0x02, 0x01, /*"b",66*/
+    0x9E, 0x07, 0xC0, 0x20, 0x20, 0x60, 0x01, 0x02, 0x02, 0x02, /*"c",67*/
+    0x9E, 0x0F, 0xC0, 0x20, 0x24, 0xFC, 0x01, 0x02, 0x02, 0x03, 0x02, /*"d",68*/
+    0x9E, 0x07, 0xC0, 0xA0, 0xA0, 0xC0, 0x01, 0x02, 0x02, 0x02, /*"e",69*/
+    0xBE, 0x07, 0x20, 0xF8, 0x24, 0x24, 0x04, 0x02, 0x03, 0x02, 0x02, /*"f",70*/
+    0xBE, 0x0F, 0x40, 0xA0, 0xA0, 0x60, 0x20, 0x07, 0x0A, 0x0A, 0x0A, 0x04, /*"g",71*/
+    0xDF, 0x0D, 0x04, 0xFC, 0x20, 0x20, 0xC0, 0x02, 0x03, 0x02, 0x03, 0x02, /*"h",72*/
+    0x86, 0x03, 0x20, 0xE4, 0x02, 0x03, 0x02, /*"i",73*/
+    0xCC, 0x03, 0x20, 0xE4, 0x08, 0x08, 0x08, 0x07, /*"j",74*/
+    0xFF, 0x0D, 0x04, 0xFC, 0x80, 0xE0, 0x20, 0x20, 0x02, 0x03, 0x02, 0x03, 0x02, /*"k",75*/
+    0xC7, 0x07, 0x04, 0x04, 0xFC, 0x02, 0x02, 0x03, 0x02, 0x02, /*"l",76*/
+    0x5F, 0x05, 0xE0, 0x20, 0xE0, 0x20, 0xC0, 0x03, 0x03, 0x03, /*"m",77*/
+    0xDF, 0x0D, 0x20, 0xE0, 0x20, 0x20, 0xC0, 0x02, 0x03, 0x02, 0x03, 0x02, /*"n",78*/
+    0x9E, 0x07, 0xC0, 0x20, 0x20, 0xC0, 0x01, 0x02, 0x02, 0x01, /*"o",79*/
+    0xDF, 0x07, 0x20, 0xE0, 0x20, 0x20, 0xC0, 0x08, 0x0F, 0x0A, 0x02, 0x01, /*"p",80*/
+    0x9E, 0x0F, 0xC0, 0x20, 0x20, 0xE0, 0x01, 0x02, 0x0A, 0x0F, 0x08, /*"q",81*/
+    0xDF, 0x01, 0x20, 0xE0, 0x40, 0x20, 0x20, 0x02, 0x03, 0x02, /*"r",82*/
+    0x9E, 0x07, 0x60, 0xA0, 0xA0, 0x20, 0x02, 0x02, 0x02, 0x03, /*"s",83*/
+    0x0E, 0x07, 0x20, 0xF8, 0x20, 0x01, 0x02, 0x02, /*"t",84*/
+    0x9B, 0x0F, 0x20, 0xE0, 0x20, 0xE0, 0x01, 0x02, 0x02, 0x03, 0x02, /*"u",85*/
+    0x3F, 0x03, 0x20, 0xE0, 0x20, 0x80, 0x60, 0x20, 0x03, 0x01, /*"v",86*/
+    0x9F, 0x02, 0x60, 0x80, 0xE0, 0x80, 0x60, 0x03, 0x03, /*"w",87*/
+    0xDF, 0x06, 0x20, 0x60, 0x80, 0x60, 0x20, 0x02, 0x03, 0x03, 0x02, /*"x",88*/
+    0xFF, 0x03, 0x20, 0xE0, 0x20, 0x80, 0x60, 0x20, 0x08, 0x08, 0x07, 0x01, /*"y",89*/
+    0x9E, 0x07, 0x20, 0xA0, 0x60, 0x20, 0x02, 0x03, 0x02, 0x02, /*"z",90*/
+    0x1C, 0x06, 0x20, 0xDE, 0x02, 0x07, 0x04, /*"{",91*/
+    0x08, 0x02, 0xFF, 0x0F, /*"|",92*/
+    0x8E, 0x01, 0x02, 0xDE, 0x20, 0x04, 0x07, /*"}",93*/
+    0x3F, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x02, /*"~",94*/
 };
 
-const ASCIIFont afont12x6 = {12, 6, (unsigned char *)ascii_12x6};
-
-const unsigned char ascii_16x8[][16] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*" ",0*/
-    {0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x00}, /*"!",1*/
-    {0x00, 0x10, 0x0C, 0x06, 0x10, 0x0C, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*""",2*/
-    {0x40, 0xC0, 0x78, 0x40, 0xC0, 0x78, 0x40, 0x00, 0x04, 0x3F, 0x04, 0x04, 0x3F, 0x04, 0x04, 0x00}, /*"#",3*/
-    {0x00, 0x70, 0x88, 0xFC, 0x08, 0x30, 0x00, 0x00, 0x00, 0x18, 0x20, 0xFF, 0x21, 0x1E, 0x00, 0x00}, /*"$",4*/
-    {0xF0, 0x08, 0xF0, 0x00, 0xE0, 0x18, 0x00, 0x00, 0x00, 0x21, 0x1C, 0x03, 0x1E, 0x21, 0x1E, 0x00}, /*"%",5*/
-    {0x00, 0xF0, 0x08, 0x88, 0x70, 0x00, 0x00, 0x00, 0x1E, 0x21, 0x23, 0x24, 0x19, 0x27, 0x21, 0x10}, /*"&",6*/
-    {0x10, 0x16, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"'",7*/
-    {0x00, 0x00, 0x00, 0xE0, 0x18, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x20, 0x40, 0x00}, /*"(",8*/
-    {0x00, 0x02, 0x04, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x18, 0x07, 0x00, 0x00, 0x00}, /*")",9*/
-    {0x40, 0x40, 0x80, 0xF0, 0x80, 0x40, 0x40, 0x00, 0x02, 0x02, 0x01, 0x0F, 0x01, 0x02, 0x02, 0x00}, /*"*",10*/
-    {0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x01, 0x00}, /*"+",11*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xB0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00}, /*",",12*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01}, /*"-",13*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00}, /*".",14*/
-    {0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x18, 0x04, 0x00, 0x60, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00}, /*"/",15*/
-    {0x00, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x00, 0x0F, 0x10, 0x20, 0x20, 0x10, 0x0F, 0x00}, /*"0",16*/
-    {0x00, 0x10, 0x10, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x00, 0x00}, /*"1",17*/
-    {0x00, 0x70, 0x08, 0x08, 0x08, 0x88, 0x70, 0x00, 0x00, 0x30, 0x28, 0x24, 0x22, 0x21, 0x30, 0x00}, /*"2",18*/
-    {0x00, 0x30, 0x08, 0x88, 0x88, 0x48, 0x30, 0x00, 0x00, 0x18, 0x20, 0x20, 0x20, 0x11, 0x0E, 0x00}, /*"3",19*/
-    {0x00, 0x00, 0xC0, 0x20, 0x10, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x04, 0x24, 0x24, 0x3F, 0x24, 0x00}, /*"4",20*/
-    {0x00, 0xF8, 0x08, 0x88, 0x88, 0x08, 0x08, 0x00, 0x00, 0x19, 0x21, 0x20, 0x20, 0x11, 0x0E, 0x00}, /*"5",21*/
-    {0x00, 0xE0, 0x10, 0x88, 0x88, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x20, 0x20, 0x11, 0x0E, 0x00}, /*"6",22*/
-    {0x00, 0x38, 0x08, 0x08, 0xC8, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00}, /*"7",23*/
-    {0x00, 0x70, 0x88, 0x08, 0x08, 0x88, 0x70, 0x00, 0x00, 0x1C, 0x22, 0x21, 0x21, 0x22, 0x1C, 0x00}, /*"8",24*/
-    {0x00, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x31, 0x22, 0x22, 0x11, 0x0F, 0x00}, /*"9",25*/
-    {0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00}, /*":",26*/
-    {0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00}, /*";",27*/
-    {0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00}, /*"<",28*/
-    {0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00}, /*"=",29*/
-    {0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00}, /*">",30*/
-    {0x00, 0x70, 0x48, 0x08, 0x08, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x01, 0x00, 0x00}, /*"?",31*/
-    {0xC0, 0x30, 0xC8, 0x28, 0xE8, 0x10, 0xE0, 0x00, 0x07, 0x18, 0x27, 0x24, 0x23, 0x14, 0x0B, 0x00}, /*"@",32*/
-    {0x00, 0x00, 0xC0, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x20, 0x3C, 0x23, 0x02, 0x02, 0x27, 0x38, 0x20}, /*"A",33*/
-    {0x08, 0xF8, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x11, 0x0E, 0x00}, /*"B",34*/
-    {0xC0, 0x30, 0x08, 0x08, 0x08, 0x08, 0x38, 0x00, 0x07, 0x18, 0x20, 0x20, 0x20, 0x10, 0x08, 0x00}, /*"C",35*/
-    {0x08, 0xF8, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x10, 0x0F, 0x00}, /*"D",36*/
-    {0x08, 0xF8, 0x88, 0x88, 0xE8, 0x08, 0x10, 0x00, 0x20, 0x3F, 0x20, 0x20, 0x23, 0x20, 0x18, 0x00}, /*"E",37*/
-    {0x08, 0xF8, 0x88, 0x88, 0xE8, 0x08, 0x10, 0x00, 0x20, 0x3F, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00}, /*"F",38*/
-    {0xC0, 0x30, 0x08, 0x08, 0x08, 0x38, 0x00, 0x00, 0x07, 0x18, 0x20, 0x20, 0x22, 0x1E, 0x02, 0x00}, /*"G",39*/
-    {0x08, 0xF8, 0x08, 0x00, 0x00, 0x08, 0xF8, 0x08, 0x20, 0x3F, 0x21, 0x01, 0x01, 0x21, 0x3F, 0x20}, /*"H",40*/
-    {0x00, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x00, 0x00}, /*"I",41*/
-    {0x00, 0x00, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x00, 0xC0, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x00}, /*"J",42*/
-    {0x08, 0xF8, 0x88, 0xC0, 0x28, 0x18, 0x08, 0x00, 0x20, 0x3F, 0x20, 0x01, 0x26, 0x38, 0x20, 0x00}, /*"K",43*/
-    {0x08, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x20, 0x30, 0x00}, /*"L",44*/
-    {0x08, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x08, 0x00, 0x20, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x20, 0x00}, /*"M",45*/
-    {0x08, 0xF8, 0x30, 0xC0, 0x00, 0x08, 0xF8, 0x08, 0x20, 0x3F, 0x20, 0x00, 0x07, 0x18, 0x3F, 0x00}, /*"N",46*/
-    {0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x0F, 0x10, 0x20, 0x20, 0x20, 0x10, 0x0F, 0x00}, /*"O",47*/
-    {0x08, 0xF8, 0x08, 0x08, 0x08, 0x08, 0xF0, 0x00, 0x20, 0x3F, 0x21, 0x01, 0x01, 0x01, 0x00, 0x00}, /*"P",48*/
-    {0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x00, 0x0F, 0x18, 0x24, 0x24, 0x38, 0x50, 0x4F, 0x00}, /*"Q",49*/
-    {0x08, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x20, 0x3F, 0x20, 0x00, 0x03, 0x0C, 0x30, 0x20}, /*"R",50*/
-    {0x00, 0x70, 0x88, 0x08, 0x08, 0x08, 0x38, 0x00, 0x00, 0x38, 0x20, 0x21, 0x21, 0x22, 0x1C, 0x00}, /*"S",51*/
-    {0x18, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x18, 0x00, 0x00, 0x00, 0x20, 0x3F, 0x20, 0x00, 0x00, 0x00}, /*"T",52*/
-    {0x08, 0xF8, 0x08, 0x00, 0x00, 0x08, 0xF8, 0x08, 0x00, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x1F, 0x00}, /*"U",53*/
-    {0x08, 0x78, 0x88, 0x00, 0x00, 0xC8, 0x38, 0x08, 0x00, 0x00, 0x07, 0x38, 0x0E, 0x01, 0x00, 0x00}, /*"V",54*/
-    {0xF8, 0x08, 0x00, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x03, 0x3C, 0x07, 0x00, 0x07, 0x3C, 0x03, 0x00}, /*"W",55*/
-    {0x08, 0x18, 0x68, 0x80, 0x80, 0x68, 0x18, 0x08, 0x20, 0x30, 0x2C, 0x03, 0x03, 0x2C, 0x30, 0x20}, /*"X",56*/
-    {0x08, 0x38, 0xC8, 0x00, 0xC8, 0x38, 0x08, 0x00, 0x00, 0x00, 0x20, 0x3F, 0x20, 0x00, 0x00, 0x00}, /*"Y",57*/
-    {0x10, 0x08, 0x08, 0x08, 0xC8, 0x38, 0x08, 0x00, 0x20, 0x38, 0x26, 0x21, 0x20, 0x20, 0x18, 0x00}, /*"Z",58*/
-    {0x00, 0x00, 0x00, 0xFE, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x00}, /*"[",59*/
-    {0x00, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x38, 0xC0, 0x00}, /*"\",60*/
-    {0x00, 0x02, 0x02, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x7F, 0x00, 0x00, 0x00}, /*"]",61*/
-    {0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"^",62*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, /*"_",63*/
-    {0x00, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"`",64*/
-    {0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x19, 0x24, 0x22, 0x22, 0x22, 0x3F, 0x20}, /*"a",65*/
-    {0x08, 0xF8, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x11, 0x20, 0x20, 0x11, 0x0E, 0x00}, /*"b",66*/
-    {0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11, 0x00}, /*"c",67*/
-    {0x00, 0x00, 0x00, 0x80, 0x80, 0x88, 0xF8, 0x00, 0x00, 0x0E, 0x11, 0x20, 0x20, 0x10, 0x3F, 0x20}, /*"d",68*/
-    {0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x22, 0x22, 0x22, 0x22, 0x13, 0x00}, /*"e",69*/
-    {0x00, 0x80, 0x80, 0xF0, 0x88, 0x88, 0x88, 0x18, 0x00, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x00, 0x00}, /*"f",70*/
-    {0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x6B, 0x94, 0x94, 0x94, 0x93, 0x60, 0x00}, /*"g",71*/
-    {0x08, 0xF8, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x20, 0x3F, 0x21, 0x00, 0x00, 0x20, 0x3F, 0x20}, /*"h",72*/
-    {0x00, 0x80, 0x98, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x00, 0x00}, /*"i",73*/
-    {0x00, 0x00, 0x00, 0x80, 0x98, 0x98, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00}, /*"j",74*/
-    {0x08, 0xF8, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x20, 0x3F, 0x24, 0x02, 0x2D, 0x30, 0x20, 0x00}, /*"k",75*/
-    {0x00, 0x08, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x00, 0x00}, /*"l",76*/
-    {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x20, 0x3F, 0x20, 0x00, 0x3F, 0x20, 0x00, 0x3F}, /*"m",77*/
-    {0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x20, 0x3F, 0x21, 0x00, 0x00, 0x20, 0x3F, 0x20}, /*"n",78*/
-    {0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x1F, 0x00}, /*"o",79*/
-    {0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xA1, 0x20, 0x20, 0x11, 0x0E, 0x00}, /*"p",80*/
-    {0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x11, 0x20, 0x20, 0xA0, 0xFF, 0x80}, /*"q",81*/
-    {0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x20, 0x20, 0x3F, 0x21, 0x20, 0x00, 0x01, 0x00}, /*"r",82*/
-    {0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x33, 0x24, 0x24, 0x24, 0x24, 0x19, 0x00}, /*"s",83*/
-    {0x00, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x20, 0x00, 0x00}, /*"t",84*/
-    {0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x1F, 0x20, 0x20, 0x20, 0x10, 0x3F, 0x20}, /*"u",85*/
-    {0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x01, 0x0E, 0x30, 0x08, 0x06, 0x01, 0x00}, /*"v",86*/
-    {0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x80, 0x80, 0x0F, 0x30, 0x0C, 0x03, 0x0C, 0x30, 0x0F, 0x00}, /*"w",87*/
-    {0x00, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x20, 0x31, 0x2E, 0x0E, 0x31, 0x20, 0x00}, /*"x",88*/
-    {0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x81, 0x8E, 0x70, 0x18, 0x06, 0x01, 0x00}, /*"y",89*/
-    {0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x21, 0x30, 0x2C, 0x22, 0x21, 0x30, 0x00}, /*"z",90*/
-    {0x00, 0x00, 0x00, 0x00, 0x80, 0x7C, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x40}, /*"{",91*/
-    {0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00}, /*"|",92*/
-    {0x00, 0x02, 0x02, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00}, /*"}",93*/
-    {0x00, 0x06, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"~",94*/
+const uint16_t ascii_12x6_index[] = {0, 22, 63, 95, 117, 160, 201, 232, 265, 311, 357, 405, 450, 496, 534, 575, 603, 638, 682, 722, 764, 807, 845, 885};
+
+const ASCIIFont afont12x6 = {12, 6, (unsigned char *)ascii_12x6_packed, NULL, NULL, 0, 1, ascii_12x6_index};
+// glyph_pack.py: afont12x6 end
+
+// glyph_pack.py: afont16x8 begin
+// 压缩字体 由 scripts/font_converter/glyph_pack.py 从 ascii_16x8.c 生成, 请勿手工修改
+const unsigned char ascii_16x8_packed[] = {
+    0x00, 0x00, /*" ",0*/
+    0x08, 0x18, 0xF8, 0x33, 0x30, /*"!",1*/
+    0x7E, 0x00, 0x10, 0x0C, 0x06, 0x10, 0x0C, 0x06, /*""",2*/
+    0x7F, 0x7F, 0x40, 0xC0, 0x78, 0x40, 0xC0, 0x78, 0x40, 0x04, 0x3F, 0x04, 0x04, 0x3F, 0x04, 0x04, /*"#",3*/
+    0x3E, 0x3E, 0x70, 0x88, 0xFC, 0x08, 0x30, 0x18, 0x20, 0xFF, 0x21, 0x1E, /*"$",4*/
+    0x37, 0x7E, 0xF0, 0x08, 0xF0, 0xE0, 0x18, 0x21, 0x1C, 0x03, 0x1E, 0x21, 0x1E, /*"%",5*/
+    0x1E, 0xFF, 0xF0, 0x08, 0x88, 0x70, 0x1E, 0x21, 0x23, 0x24, 0x19, 0x27, 0x21, 0x10, /*"&",6*/
+    0x07, 0x00, 0x10, 0x16, 0x0E, /*"'",7*/
+    0x78, 0x78, 0xE0, 0x18, 0x04, 0x02, 0x07, 0x18, 0x20, 0x40, /*"(",8*/
+    0x1E, 0x1E, 0x02, 0x04, 0x18, 0xE0, 0x40, 0x20, 0x18, 0x07, /*")",9*/
+    0x7F, 0x7F, 0x40, 0x40, 0x80, 0xF0, 0x80, 0x40, 0x40, 0x02, 0x02, 0x01, 0x0F, 0x01, 0x02, 0x02, /*"*",10*/
+    0x08, 0x7F, 0xF0, 0x01, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x01, /*"+",11*/
+    0x00, 0x07, 0x80, 0xB0, 0x70, /*",",12*/
+    0x00, 0xFE, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, /*"-",13*/
+    0x00, 0x06, 0x30, 0x30, /*".",14*/
+    0xF0, 0x1E, 0x80, 0x60, 0x18, 0x04, 0x60, 0x18, 0x06, 0x01, /*"/",15*/
+    0x7E, 0x7E, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, 0x0F, 0x10, 0x20, 0x20, 0x10, 0x0F, /*"0",16*/
+    0x0E, 0x3E, 0x10, 0x10, 0xF8, 0x20, 0x20, 0x3F, 0x20, 0x20, /*"1",17*/
+    0x7E, 0x7E, 0x70, 0x08, 0x08, 0x08, 0x88, 0x70, 0x30, 0x28, 0x24, 0x22, 0x21, 0x30, /*"2",18*/
+    0x7E, 0x7E, 0x30, 0x08, 0x88, 0x88, 0x48, 0x30, 0x18, 0x20, 0x20, 0x20, 0x11, 0x0E, /*"3",19*/
+    0x3C, 0x7E, 0xC0, 0x20, 0x10, 0xF8, 0x07, 0x04, 0x24, 0x24, 0x3F, 0x24, /*"4",20*/
+    0x7E, 0x7E, 0xF8, 0x08, 0x88, 0x88, 0x08, 0x08, 0x19, 0x21, 0x20, 0x20, 0x11, 0x0E, /*"5",21*/
+    0x3E, 0x7E, 0xE0, 0x10, 0x88, 0x88, 0x18, 0x0F, 0x11, 0x20, 0x20, 0x11, 0x0E, /*"6",22*/
+    0x7E, 0x08, 0x38, 0x08, 0x08, 0xC8, 0x38, 0x08, 0x3F, /*"7",23*/
+    0x7E, 0x7E, 0x70, 0x88, 0x08, 0x08, 0x88, 0x70, 0x1C, 0x22, 0x21, 0x21, 0x22, 0x1C, /*"8",24*/
+    0x7E, 0x7C, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, 0x31, 0x22, 0x22, 0x11, 0x0F, /*"9",25*/
+    0x18, 0x18, 0xC0, 0xC0, 0x30, 0x30, /*":",26*/
+    0x08, 0x0C, 0x80, 0x80, 0x60, /*";",27*/
+    0x7C, 0x7E, 0x80, 0x40, 0x20, 0x10, 0x08, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, /*"<",28*/
+    0x7F, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, /*"=",29*/
+    0x3E, 0x7E, 0x08, 0x10, 0x20, 0x40, 0x80, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, /*">",30*/
+    0x7E, 0x38, 0x70, 0x48, 0x08, 0x08, 0x08, 0xF0, 0x30, 0x36, 0x01, /*"?",31*/
+    0x7F, 0x7F, 0xC0, 0x30, 0xC8, 0x28, 0xE8, 0x10, 0xE0, 0x07, 0x18, 0x27, 0x24, 0x23, 0x14, 0x0B, /*"@",32*/
+    0x1C, 0xFF, 0xC0, 0x38, 0xE0, 0x20, 0x3C, 0x23, 0x02, 0x02, 0x27, 0x38, 0x20, /*"A",33*/
+    0x3F, 0x7F, 0x08, 0xF8, 0x88, 0x88, 0x88, 0x70, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x11, 0x0E, /*"B",34*/
+    0x7F, 0x7F, 0xC0, 0x30, 0x08, 0x08, 0x08, 0x08, 0x38, 0x07, 0x18, 0x20, 0x20, 0x20, 0x10, 0x08, /*"C",35*/
+    0x7F, 0x7F, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x10, 0x0F, /*"D",36*/
+    0x7F, 0x7F, 0x08, 0xF8, 0x88, 0x88, 0xE8, 0x08, 0x10, 0x20, 0x3F, 0x20, 0x20, 0x23, 0x20, 0x18, /*"E",37*/
+    0x7F, 0x17, 0x08, 0xF8, 0x88, 0x88, 0xE8, 0x08, 0x10, 0x20, 0x3F, 0x20, 0x03, /*"F",38*/
+    0x3F, 0x7F, 0xC0, 0x30, 0x08, 0x08, 0x08, 0x38, 0x07, 0x18, 0x20, 0x20, 0x22, 0x1E, 0x02, /*"G",39*/
+    0xE7, 0xFF, 0x08, 0xF8, 0x08, 0x08, 0xF8, 0x08, 0x20, 0x3F, 0x21, 0x01, 0x01, 0x21, 0x3F, 0x20, /*"H",40*/
+    0x3E, 0x3E, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x20, 0x20, 0x3F, 0x20, 0x20, /*"I",41*/
+    0x7C, 0x1F, 0x08, 0x08, 0xF8, 0x08, 0x08, 0xC0, 0x80, 0x80, 0x80, 0x7F, /*"J",42*/
+    0x7F, 0x7F, 0x08, 0xF8, 0x88, 0xC0, 0x28, 0x18, 0x08, 0x20, 0x3F, 0x20, 0x01, 0x26, 0x38, 0x20, /*"K",43*/
+    0x07, 0x7F, 0x08, 0xF8, 0x08, 0x20, 0x3F, 0x20, 0x20, 0x20, 0x20, 0x30, /*"L",44*/
+    0x77, 0x6B, 0x08, 0xF8, 0xF8, 0xF8, 0xF8, 0x08, 0x20, 0x3F, 0x3F, 0x3F, 0x20, /*"M",45*/
+    0xEF, 0x77, 0x08, 0xF8, 0x30, 0xC0, 0x08, 0xF8, 0x08, 0x20, 0x3F, 0x20, 0x07, 0x18, 0x3F, /*"N",46*/
+    0x7F, 0x7F, 0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x0F, 0x10, 0x20, 0x20, 0x20, 0x10, 0x0F, /*"O",47*/
+    0x7F, 0x3F, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x08, 0xF0, 0x20, 0x3F, 0x21, 0x01, 0x01, 0x01, /*"P",48*/
+    0x7F, 0x7F, 0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x0F, 0x18, 0x24, 0x24, 0x38, 0x50, 0x4F, /*"Q",49*/
+    0x7F, 0xF7, 0x08, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x70, 0x20, 0x3F, 0x20, 0x03, 0x0C, 0x30, 0x20, /*"R",50*/
+    0x7E, 0x7E, 0x70, 0x88, 0x08, 0x08, 0x08, 0x38, 0x38, 0x20, 0x21, 0x21, 0x22, 0x1C, /*"S",51*/
+    0x7F, 0x1C, 0x18, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x18, 0x20, 0x3F, 0x20, /*"T",52*/
+    0xE7, 0x7E, 0x08, 0xF8, 0x08, 0x08, 0xF8, 0x08, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x1F, /*"U",53*/
+    0xE7, 0x3C, 0x08, 0x78, 0x88, 0xC8, 0x38, 0x08, 0x07, 0x38, 0x0E, 0x01, /*"V",54*/
+    0x6B, 0x77, 0xF8, 0x08, 0xF8, 0x08, 0xF8, 0x03, 0x3C, 0x07, 0x07, 0x3C, 0x03, /*"W",55*/
+    0xFF, 0xFF, 0x08, 0x18, 0x68, 0x80, 0x80, 0x68, 0x18, 0x08, 0x20, 0x30, 0x2C, 0x03, 0x03, 0x2C, 0x30, 0x20, /*"X",56*/
+    0x77, 0x1C, 0x08, 0x38, 0xC8, 0xC8, 0x38, 0x08, 0x20, 0x3F, 0x20, /*"Y",57*/
+    0x7F, 0x7F, 0x10, 0x08, 0x08, 0x08, 0xC8, 0x38, 0x08, 0x20, 0x38, 0x26, 0x21, 0x20, 0x20, 0x18, /*"Z",58*/
+    0x78, 0x78, 0xFE, 0x02, 0x02, 0x02, 0x7F, 0x40, 0x40, 0x40, /*"[",59*/
+    0x0E, 0x78, 0x0C, 0x30, 0xC0, 0x01, 0x06, 0x38, 0xC0, /*"\",60*/
+    0x1E, 0x1E, 0x02, 0x02, 0x02, 0xFE, 0x40, 0x40, 0x40, 0x7F, /*"]",61*/
+    0x7C, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, /*"^",62*/
+    0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, /*"_",63*/
+    0x0E, 0x00, 0x02, 0x02, 0x04, /*"`",64*/
+    0x3C, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x19, 0x24, 0x22, 0x22, 0x22, 0x3F, 0x20, /*"a",65*/
+    0x1B, 0x7E, 0x08, 0xF8, 0x80, 0x80, 0x3F, 0x11, 0x20, 0x20, 0x11, 0x0E, /*"b",66*/
+    0x38, 0x7E, 0x80, 0x80, 0x80, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11, /*"c",67*/
+    0x78, 0xFE, 0x80, 0x80, 0x88, 0xF8, 0x0E, 0x11, 0x20, 0x20, 0x10, 0x3F, 0x20, /*"d",68*/
+    0x3C, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x22, 0x22, 0x22, 0x22, 0x13, /*"e",69*/
+    0xFE, 0x3E, 0x80, 0x80, 0xF0, 0x88, 0x88, 0x88, 0x18, 0x20, 0x20, 0x3F, 0x20, 0x20, /*"f",70*/
+    0x7C, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6B, 0x94, 0x94, 0x94, 0x93, 0x60, /*"g",71*/
+    0x3B, 0xE7, 0x08, 0xF8, 0x80, 0x80, 0x80, 0x20, 0x3F, 0x21, 0x20, 0x3F, 0x20, /*"h",72*/
+    0x0E, 0x3E, 0x80, 0x98, 0x98, 0x20, 0x20, 0x3F, 0x20, 0x20, /*"i",73*/
+    0x38, 0x3E, 0x80, 0x98, 0x98, 0xC0, 0x80, 0x80, 0x80, 0x7F, /*"j",74*/
+    0x73, 0x7F, 0x08, 0xF8, 0x80, 0x80, 0x80, 0x20, 0x3F, 0x24, 0x02, 0x2D, 0x30, 0x20, /*"k",75*/
+    0x0E, 0x3E, 0x08, 0x08, 0xF8, 0x20, 0x20, 0x3F, 0x20, 0x20, /*"l",76*/
+    0x7F, 0xB7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x3F, 0x20, 0x3F, 0x20, 0x3F, /*"m",77*/
+    0x3B, 0xE7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x3F, 0x21, 0x20, 0x3F, 0x20, /*"n",78*/
+    0x3C, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x1F, /*"o",79*/
+    0x1B, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xA1, 0x20, 0x20, 0x11, 0x0E, /*"p",80*/
+    0x78, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x0E, 0x11, 0x20, 0x20, 0xA0, 0xFF, 0x80, /*"q",81*/
+    0x77, 0x5F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x20, 0x3F, 0x21, 0x20, 0x01, /*"r",82*/
+    0x7C, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x33, 0x24, 0x24, 0x24, 0x24, 0x19, /*"s",83*/
+    0x3E, 0x38, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x1F, 0x20, 0x20, /*"t",84*/
+    0x63, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x20, 0x20, 0x20, 0x10, 0x3F, 0x20, /*"u",85*/
+    0xE7, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x0E, 0x30, 0x08, 0x06, 0x01, /*"v",86*/
+    0xEB, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x0F, 0x30, 0x0C, 0x03, 0x0C, 0x30, 0x0F, /*"w",87*/
+    0x76, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x31, 0x2E, 0x0E, 0x31, 0x20, /*"x",88*/
+    0xE7, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x8E, 0x70, 0x18, 0x06, 0x01, /*"y",89*/
+    0x7E, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x21, 0x30, 0x2C, 0x22, 0x21, 0x30, /*"z",90*/
+    0xF0, 0xE0, 0x80, 0x7C, 0x02, 0x02, 0x3F, 0x40, 0x40, /*"{",91*/
+    0x10, 0x10, 0xFF, 0xFF, /*"|",92*/
+    0x1E, 0x0E, 0x02, 0x02, 0x7C, 0x80, 0x40, 0x40, 0x3F, /*"}",93*/
+    0xFE, 0x00, 0x06, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, /*"~",94*/
+};
+
+const uint16_t ascii_16x8_index[] = {0, 31, 75, 121, 149, 201, 249, 287, 340, 400, 460, 516, 572, 633, 684, 739, 775, 816, 868, 915, 965, 1018, 1070, 1121};
+
+const ASCIIFont afont16x8 = {16, 8, (unsigned char *)ascii_16x8_packed, NULL, NULL, 0, 1, ascii_16x8_index};
+// glyph_pack.py: afont16x8 end
+
+// ascii_prop.py: afont24x12 begin
+// 比例字体 由 scripts/font_converter/ascii_prop.py 从 ascii_24x12.c 生成, 请勿手工修改
+const unsigned char ascii_24x12_data[] = {
+    0xFF, 0x01, 0xF0, 0xF0, 0xF0, 0x01, 0x7F, 0x01, 0x1C, 0x1C, 0x1C, /*"!",1*/
+    0xFF, 0x01, 0x00, 0x00, 0x80, 0x60, 0x30, 0x1C, 0x8C, 0x60, 0x30, 0x1C, 0x0C, /*""",2*/
+    0x04, 0xFD, 0xFF, 0x3F, 0xE0, 0xE0, 0x86, 0xE6, 0x9F, 0x86, 0x86, 0x86, 0x86, 0xE6, 0x9F, 0x86, 0x01, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x01, 0x01, /*"#",3*/
+    0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0x60, 0x20, 0xF8, 0x20, 0xE0, 0xC0, 0x03, 0x07, 0x0C, 0x18, 0xFF, 0x70, 0xE1, 0x81, 0x07, 0x0F, 0x10, 0x10, 0x7F, 0x10, 0x0F, 0x07, /*"$",4*/
+    0x1F, 0xFB, 0x3F, 0xF7, 0x01, 0x80, 0x60, 0x20, 0x60, 0x80, 0xE0, 0x20, 0x0F, 0x30, 0x20, 0x30, 0x9F, 0x70, 0xDC, 0x37, 0x10, 0x30, 0xC0, 0x10, 0x0E, 0x03, 0x07, 0x18, 0x10, 0x18, 0x07, /*"%",5*/
+    0x7C, 0xF8, 0xDF, 0xFF, 0x01, 0xC0, 0x20, 0x20, 0xE0, 0xC0, 0x80, 0xE0, 0x1F, 0x38, 0xE8, 0x87, 0x03, 0xC4, 0x3C, 0x04, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x0B, 0x07, 0x0D, 0x10, 0x10, 0x08, /*"&",6*/
+    0x0F, 0x00, 0x80, 0x8C, 0x4C, 0x38, /*"'",7*/
+    0xFE, 0xE1, 0x03, 0x80, 0xE0, 0x30, 0x08, 0x04, 0xFE, 0xFF, 0x01, 0x03, 0x0F, 0x18, 0x20, 0x40, /*"(",8*/
+    0x1F, 0xFE, 0x01, 0x04, 0x08, 0x30, 0xE0, 0x80, 0x01, 0xFF, 0xFE, 0x40, 0x20, 0x18, 0x0F, 0x03, /*")",9*/
+    0x20, 0xF8, 0x3F, 0x08, 0x00, 0xC0, 0x42, 0x66, 0x66, 0x3C, 0x18, 0xFF, 0x18, 0x3C, 0x66, 0x66, 0x42, 0x03, /*"*",10*/
+    0x20, 0xF8, 0x3F, 0x08, 0x00, 0x80, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x10, 0x03, /*"+",11*/
+    0x00, 0x0F, 0x80, 0x8C, 0x4C, 0x38, /*",",12*/
+    0x00, 0xFC, 0x0F, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, /*"-",13*/
+    0xC0, 0x01, 0x1C, 0x1C, 0x1C, /*".",14*/
+    0x80, 0xE3, 0xF1, 0x00, 0xE0, 0x38, 0x0C, 0x80, 0x70, 0x1C, 0x03, 0x60, 0x38, 0x0E, 0x01, /*"/",15*/
+    0xFE, 0x1D, 0xFE, 0x3F, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xC0, 0x80, 0xFE, 0xFF, 0x01, 0x01, 0xFF, 0xFE, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x18, 0x0E, 0x07, 0x01, /*"0",16*/
+    0x1F, 0x18, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, /*"1",17*/
+    0xFF, 0xF7, 0xFF, 0x07, 0x80, 0x40, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x03, 0x03, 0x80, 0x40, 0x20, 0x38, 0x1F, 0x07, 0x1C, 0x1A, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, /*"2",18*/
+    0xFF, 0xF6, 0xFF, 0x07, 0x80, 0xC0, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x03, 0x03, 0x10, 0x10, 0x18, 0x2F, 0xE7, 0x80, 0x07, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, /*"3",19*/
+    0xE0, 0xFC, 0x0F, 0x3F, 0xC0, 0xE0, 0xF0, 0xC0, 0xB0, 0x88, 0x86, 0x81, 0x80, 0xFF, 0xFF, 0x80, 0x80, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, /*"4",20*/
+    0xFE, 0xFD, 0xFF, 0x07, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x3F, 0x10, 0x08, 0x08, 0x08, 0x18, 0xF0, 0xE0, 0x07, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x0F, 0x03, /*"5",21*/
+    0xFE, 0xFD, 0xFF, 0x3F, 0x80, 0xC0, 0x40, 0x20, 0x20, 0x20, 0xE0, 0xC0, 0xFC, 0xFF, 0x21, 0x10, 0x08, 0x08, 0x08, 0x18, 0xF0, 0xE0, 0x01, 0x07, 0x0C, 0x18, 0x10, 0x10, 0x10, 0x08, 0x0F, 0x03, /*"6",22*/
+    0xFF, 0xE3, 0x60, 0x00, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0x60, 0x03, 0xE0, 0x18, 0x07, 0x1F, 0x1F, /*"7",23*/
+    0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x87, 0xEF, 0x2C, 0x18, 0x18, 0x30, 0x30, 0x68, 0xCF, 0x83, 0x07, 0x0F, 0x08, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, /*"8",24*/
+    0xFE, 0xFD, 0xEF, 0x1F, 0xC0, 0xC0, 0x20, 0x20, 0x20, 0x20, 0xC0, 0x80, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x40, 0x20, 0x10, 0xFF, 0xFE, 0x0C, 0x1C, 0x10, 0x10, 0x10, 0x08, 0x0F, 0x03, /*"9",25*/
+    0xF8, 0x01, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x1C, /*":",26*/
+    0x3C, 0x0C, 0x0C, 0x58, 0x38, /*";",27*/
+    0xE0, 0x3F, 0xC0, 0x07, 0x80, 0x40, 0x20, 0x10, 0x10, 0x28, 0x44, 0x82, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, /*"<",28*/
+    0x00, 0xFC, 0x0F, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, /*"=",29*/
+    0x0F, 0xE0, 0x7F, 0x00, 0x10, 0x20, 0x40, 0x80, 0x01, 0x82, 0x44, 0x28, 0x10, 0x10, 0x08, 0x04, 0x02, 0x01, /*">",30*/
+    0xFF, 0xCF, 0x8F, 0x03, 0xC0, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x30, 0xE0, 0xC0, 0x03, 0x03, 0xF0, 0x10, 0x08, 0x0C, 0x07, 0x03, 0x1C, 0x1C, 0x1C, /*"?",31*/
+    0xFC, 0xFB, 0xFF, 0xFF, 0x01, 0xC0, 0x40, 0x60, 0x20, 0x20, 0x20, 0x40, 0xC0, 0xFC, 0xFF, 0x01, 0xF0, 0x0E, 0x03, 0xC1, 0xFE, 0x03, 0x80, 0x7F, 0x01, 0x07, 0x0E, 0x08, 0x11, 0x11, 0x10, 0x11, 0x09, 0x04, 0x02, /*"@",32*/
+    0x70, 0xC0, 0x3F, 0x0F, 0x0F, 0x80, 0xE0, 0xE0, 0x80, 0x7C, 0x43, 0x40, 0x47, 0x7F, 0xF8, 0x80, 0x10, 0x18, 0x1F, 0x10, 0x13, 0x1F, 0x1C, 0x10, /*"A",33*/
+    0xFF, 0xF3, 0xFF, 0xFF, 0x01, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x18, 0x2F, 0xE7, 0x80, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, /*"B",34*/
+    0xFE, 0x1F, 0xF8, 0x3F, 0x80, 0xC0, 0x40, 0x20, 0x20, 0x20, 0x20, 0x60, 0xE0, 0xFC, 0xFF, 0x01, 0x01, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x10, 0x08, 0x04, 0x03, /*"C",35*/
+    0xFF, 0x33, 0xF8, 0xFF, 0x01, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x40, 0xC0, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x18, 0x08, 0x0E, 0x07, 0x01, /*"D",36*/
+    0xFF, 0xF7, 0xC7, 0xFF, 0x01, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x80, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x06, /*"E",37*/
+    0xFF, 0xF7, 0xE7, 0x03, 0x00, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x60, 0x80, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x01, 0x10, 0x1F, 0x1F, 0x10, /*"F",38*/
+    0xFE, 0x39, 0xFF, 0x7F, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x20, 0x40, 0xE0, 0xFC, 0xFF, 0x01, 0x40, 0x40, 0xC0, 0xC1, 0x40, 0x40, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x10, 0x0F, 0x0F, /*"G",39*/
+    0x0F, 0xEF, 0x7F, 0x0F, 0x0F, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0xE0, 0xE0, 0x20, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x1F, 0x1F, 0x10, /*"H",40*/
+    0xFF, 0x18, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, /*"I",41*/
+    0xF8, 0x07, 0xC6, 0x3F, 0x00, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0x60, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0x7F, 0x3F, /*"J",42*/
+    0xCF, 0xE7, 0x0F, 0xCF, 0x0F, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0xA0, 0x60, 0x20, 0x20, 0xFF, 0xFF, 0x30, 0x18, 0x7C, 0xE3, 0xC0, 0x10, 0x1F, 0x1F, 0x10, 0x01, 0x13, 0x1F, 0x1C, 0x18, 0x10, /*"K",43*/
+    0x0F, 0x30, 0xC0, 0xFF, 0x01, 0x20, 0xE0, 0xE0, 0x20, 0xFF, 0xFF, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x06, /*"L",44*/
+    0x0F, 0xEF, 0x7F, 0x77, 0x0F, 0x20, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x20, 0xFF, 0x01, 0x3F, 0xFE, 0xC0, 0xE0, 0x1E, 0x01, 0xFF, 0xFF, 0x10, 0x1F, 0x10, 0x03, 0x1F, 0x03, 0x10, 0x1F, 0x1F, 0x10, /*"M",45*/
+    0x0F, 0xAE, 0x5F, 0x07, 0x07, 0x20, 0xE0, 0xE0, 0xC0, 0x20, 0xE0, 0x20, 0xFF, 0x03, 0x07, 0x1C, 0x78, 0xE0, 0x80, 0xFF, 0x10, 0x1F, 0x10, 0x03, 0x0F, 0x1F, /*"N",46*/
+    0xFE, 0x1D, 0xFC, 0x3F, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xC0, 0x80, 0xFE, 0xFF, 0x01, 0xFF, 0xFE, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x18, 0x0C, 0x07, 0x01, /*"O",47*/
+    0xFF, 0xF7, 0xFF, 0x03, 0x00, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x1F, 0x0F, 0x10, 0x1F, 0x1F, 0x10, /*"P",48*/
+    0xFE, 0x1D, 0xFC, 0x3F, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xC0, 0x80, 0xFE, 0xFF, 0x01, 0xFF, 0xFE, 0x01, 0x07, 0x0E, 0x11, 0x11, 0x13, 0x3C, 0x7C, 0x67, 0x21, /*"Q",49*/
+    0xFF, 0xE7, 0x7F, 0x8F, 0x0F, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0xFF, 0xFF, 0x10, 0x10, 0x30, 0xF0, 0xD0, 0x08, 0x0F, 0x07, 0x10, 0x1F, 0x1F, 0x10, 0x03, 0x0F, 0x1C, 0x10, 0x10, /*"R",50*/
+    0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0xE0, 0x07, 0x0F, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0xE0, 0x81, 0x1F, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, /*"S",51*/
+    0xFF, 0x1F, 0x86, 0xF0, 0x00, 0x80, 0x60, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x60, 0x80, 0x01, 0xFF, 0xFF, 0x01, 0x10, 0x1F, 0x1F, 0x10, /*"T",52*/
+    0x0F, 0x6E, 0x40, 0xFE, 0x07, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0xE0, 0x20, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x07, /*"U",53*/
+    0x1F, 0xCF, 0x3B, 0xF0, 0x00, 0x20, 0x60, 0xE0, 0xE0, 0x20, 0x20, 0xE0, 0x60, 0x20, 0x07, 0x7F, 0xF8, 0x80, 0x80, 0x7C, 0x03, 0x07, 0x1F, 0x1C, 0x07, /*"V",54*/
+    0xEF, 0xEE, 0x3F, 0xDC, 0x01, 0x20, 0xE0, 0xE0, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0xE0, 0x20, 0x07, 0xFF, 0xF8, 0xE0, 0x1F, 0xFF, 0xFC, 0xE0, 0x1F, 0x03, 0x1F, 0x03, 0x01, 0x1F, 0x03, /*"W",55*/
+    0xCF, 0xF3, 0xF3, 0x3E, 0x20, 0x60, 0xE0, 0xA0, 0x20, 0xE0, 0x60, 0x20, 0x03, 0x8F, 0x7C, 0xF8, 0xC6, 0x01, 0x10, 0x18, 0x1E, 0x13, 0x01, 0x17, 0x1F, 0x18, 0x10, /*"X",56*/
+    0x1F, 0xCF, 0x1F, 0xF8, 0x01, 0x20, 0x60, 0xE0, 0xE0, 0x20, 0x20, 0xE0, 0x60, 0x20, 0x01, 0x07, 0x3E, 0xF8, 0xE0, 0x18, 0x07, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, /*"Y",57*/
+    0xFF, 0xE3, 0xF3, 0x3F, 0x80, 0x60, 0x20, 0x20, 0x20, 0x20, 0xA0, 0xE0, 0xE0, 0x20, 0xC0, 0xF0, 0x3E, 0x0F, 0x03, 0x10, 0x1C, 0x1F, 0x17, 0x10, 0x10, 0x10, 0x10, 0x18, 0x06, /*"Z",58*/
+    0x7F, 0xF0, 0x03, 0xFC, 0x04, 0x04, 0x04, 0x04, 0x04, 0xFF, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, /*"[",59*/
+    0x03, 0x78, 0x80, 0x07, 0x10, 0xE0, 0x03, 0x1C, 0x60, 0x80, 0x03, 0x0C, 0x70, 0x80, /*"\",60*/
+    0x3F, 0xF8, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0xFC, 0xFF, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7F, /*"]",61*/
+    0x7F, 0x00, 0x00, 0x10, 0x08, 0x0C, 0x04, 0x0C, 0x08, 0x10, /*"^",62*/
+    0x00, 0x00, 0x00, 0xFF, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, /*"_",63*/
+    0x0F, 0x00, 0x04, 0x04, 0x08, 0x08, /*"`",64*/
+    0x00, 0xF0, 0xCF, 0xFF, 0x01, 0x98, 0xD8, 0x44, 0x64, 0x24, 0x24, 0xFC, 0xF8, 0x0F, 0x1F, 0x18, 0x10, 0x10, 0x10, 0x08, 0x1F, 0x1F, 0x10, 0x18, /*"a",65*/
+    0x07, 0xF8, 0xEF, 0x3F, 0x20, 0xE0, 0xF0, 0xFF, 0xFF, 0x18, 0x08, 0x04, 0x04, 0x0C, 0xF8, 0xF0, 0x1F, 0x0F, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x03, /*"b",66*/
+    0x00, 0xFE, 0xFD, 0x07, 0xE0, 0xF8, 0x18, 0x04, 0x04, 0x04, 0x3C, 0x38, 0x03, 0x0F, 0x0C, 0x10, 0x10, 0x10, 0x10, 0x08, 0x06, /*"c",67*/
+    0xC0, 0xFD, 0xF7, 0x3F, 0x20, 0xE0, 0xF0, 0xE0, 0xF8, 0x1C, 0x04, 0x04, 0x04, 0x08, 0xFF, 0xFF, 0x03, 0x0F, 0x18, 0x10, 0x10, 0x10, 0x08, 0x1F, 0x0F, 0x08, /*"d",68*/
+    0x00, 0xFE, 0xFF, 0x07, 0xE0, 0xF8, 0x48, 0x44, 0x44, 0x44, 0x4C, 0x78, 0x70, 0x03, 0x0F, 0x0C, 0x18, 0x10, 0x10, 0x10, 0x08, 0x04, /*"e",69*/
+    0xF8, 0xFF, 0xE7, 0x0F, 0x80, 0xC0, 0x60, 0x20, 0x20, 0xE0, 0xC0, 0x04, 0x04, 0x04, 0xFF, 0xFF, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, /*"f",70*/
+    0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x70, 0xF8, 0x8C, 0x04, 0x04, 0x8C, 0xF8, 0x74, 0x04, 0x0C, 0x70, 0x76, 0xCF, 0x8D, 0x8D, 0x8D, 0x89, 0xC8, 0x78, 0x70, /*"g",71*/
+    0x07, 0xF8, 0xF7, 0x3C, 0x20, 0xE0, 0xF0, 0xFF, 0xFF, 0x08, 0x04, 0x04, 0x04, 0xFC, 0xF8, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x1F, 0x1F, 0x10, /*"h",72*/
+    0x18, 0x1F, 0xFF, 0x60, 0x60, 0x04, 0x04, 0x04, 0xFC, 0xFC, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, /*"i",73*/
+    0x60, 0xFE, 0x1F, 0x60, 0x60, 0x04, 0x04, 0x04, 0xFC, 0xFC, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0x7F, 0x3F, /*"j",74*/
+    0x07, 0xF8, 0xF7, 0x3E, 0x20, 0xE0, 0xF0, 0xFF, 0xFF, 0x80, 0xC0, 0xF4, 0x1C, 0x04, 0x04, 0x10, 0x1F, 0x1F, 0x11, 0x03, 0x1F, 0x1C, 0x10, 0x10, /*"k",75*/
+    0x1F, 0x18, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xF0, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, /*"l",76*/
+    0x00, 0xF0, 0x7F, 0xEF, 0x0E, 0x04, 0xFC, 0xFC, 0x08, 0x04, 0xFC, 0xFC, 0x08, 0x04, 0xFC, 0xFC, 0x10, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x10, /*"m",77*/
+    0x00, 0xFC, 0xF7, 0x3C, 0x04, 0xFC, 0xFC, 0x08, 0x08, 0x04, 0x04, 0xFC, 0xF8, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x1F, 0x1F, 0x10, /*"n",78*/
+    0x00, 0xFC, 0xFF, 0x3F, 0xE0, 0xF0, 0x18, 0x0C, 0x04, 0x04, 0x0C, 0x18, 0xF0, 0xE0, 0x03, 0x0F, 0x0C, 0x10, 0x10, 0x10, 0x10, 0x0C, 0x0F, 0x03, /*"o",79*/
+    0x00, 0xFC, 0xFF, 0x3F, 0x04, 0xFC, 0xFC, 0x08, 0x04, 0x04, 0x04, 0x0C, 0xF8, 0xF0, 0x80, 0xFF, 0xFF, 0x88, 0x90, 0x10, 0x10, 0x1C, 0x0F, 0x03, /*"p",80*/
+    0x00, 0xFC, 0xF7, 0x3F, 0xE0, 0xF8, 0x1C, 0x04, 0x04, 0x04, 0x08, 0xF8, 0xFC, 0x03, 0x0F, 0x18, 0x10, 0x10, 0x90, 0x88, 0xFF, 0xFF, 0x80, /*"q",81*/
+    0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x04, 0x04, 0x04, 0xFC, 0xFC, 0x10, 0x08, 0x04, 0x04, 0x0C, 0x0C, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, /*"r",82*/
+    0x00, 0xFE, 0xFF, 0x07, 0x30, 0x78, 0xCC, 0xC4, 0x84, 0x84, 0x84, 0x0C, 0x1C, 0x1E, 0x18, 0x10, 0x10, 0x10, 0x11, 0x19, 0x0F, 0x06, /*"s",83*/
+    0x10, 0xFE, 0xE1, 0x07, 0xC0, 0x04, 0x04, 0x04, 0xFF, 0xFF, 0x04, 0x04, 0x04, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x0C, /*"t",84*/
+    0x00, 0x1C, 0xE7, 0x3F, 0x04, 0xFC, 0xFE, 0x04, 0xFC, 0xFE, 0x0F, 0x1F, 0x18, 0x10, 0x10, 0x08, 0x1F, 0x0F, 0x08, /*"u",85*/
+    0x00, 0xF8, 0x3C, 0x3E, 0x00, 0x04, 0x0C, 0x3C, 0xFC, 0xC4, 0xC4, 0x3C, 0x0C, 0x04, 0x01, 0x0F, 0x1E, 0x0E, 0x01, /*"v",86*/
+    0x00, 0xF0, 0xFE, 0x9C, 0x03, 0x04, 0x3C, 0xFC, 0xC4, 0xE4, 0x7C, 0xFC, 0x84, 0x80, 0x7C, 0x04, 0x07, 0x1F, 0x07, 0x07, 0x1F, 0x07, /*"w",87*/
+    0x00, 0xFC, 0xFF, 0x3F, 0x04, 0x04, 0x1C, 0x7C, 0xE4, 0xC0, 0x34, 0x1C, 0x04, 0x04, 0x10, 0x10, 0x1C, 0x16, 0x01, 0x13, 0x1F, 0x1C, 0x18, 0x10, /*"x",88*/
+    0x00, 0x7C, 0xEF, 0x07, 0x04, 0x0C, 0x3C, 0xFC, 0xC4, 0xC4, 0x3C, 0x04, 0x04, 0xC0, 0x80, 0xC1, 0x37, 0x0E, 0x01, /*"y",89*/
+    0x00, 0xFE, 0xFD, 0x07, 0x1C, 0x04, 0x04, 0xC4, 0xF4, 0x7C, 0x1C, 0x04, 0x10, 0x1C, 0x1F, 0x17, 0x11, 0x10, 0x10, 0x18, 0x0E, /*"z",90*/
+    0xFC, 0x70, 0xF8, 0x0C, 0x04, 0x10, 0x28, 0xEF, 0x3F, 0x60, 0x40, /*"{",91*/
+    0x07, 0xFF, 0xFF, 0xFF, /*"|",92*/
+    0x87, 0x1F, 0x04, 0x0C, 0xF8, 0xEF, 0x28, 0x10, 0x40, 0x60, 0x3F, /*"}",93*/
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x18, 0x06, 0x02, 0x02, 0x04, 0x08, 0x10, 0x20, 0x20, 0x30, 0x08, /*"~",94*/
+};
+
+const ASCIIGlyph ascii_24x12_glyphs[] = {
+    {0, 0, 0x06}, /*" "*/
+    {0, 3, 0x11}, /*"!"*/
+    {11, 9, 0x11}, /*"""*/
+    {24, 10, 0x11}, /*"#"*/
+    {50, 8, 0x11}, /*"$"*/
+    {77, 11, 0x11}, /*"%"*/
+    {108, 11, 0x11}, /*"&"*/
+    {139, 4, 0x11}, /*"'"*/
+    {145, 6, 0x11}, /*"("*/
+    {161, 6, 0x11}, /*")"*/
+    {177, 11, 0x11}, /*"*"*/
+    {195, 11, 0x11}, /*"+"*/
+    {213, 4, 0x11}, /*","*/
+    {219, 10, 0x11}, /*"-"*/
+    {233, 3, 0x11}, /*"."*/
+    {238, 10, 0x11}, /*"/"*/
+    {253, 10, 0x11}, /*"0"*/
+    {281, 8, 0x22}, /*"1"*/
+    {299, 9, 0x12}, /*"2"*/
+    {329, 9, 0x12}, /*"3"*/
+    {358, 10, 0x11}, /*"4"*/
+    {381, 9, 0x12}, /*"5"*/
+    {410, 10, 0x11}, /*"6"*/
+    {442, 9, 0x12}, /*"7"*/
+    {461, 10, 0x11}, /*"8"*/
+    {495, 10, 0x11}, /*"9"*/
+    {525, 3, 0x11}, /*":"*/
+    {533, 2, 0x11}, /*";"*/
+    {538, 9, 0x11}, /*"<"*/
+    {556, 10, 0x11}, /*"="*/
+    {570, 9, 0x11}, /*">"*/
+    {588, 10, 0x11}, /*"?"*/
+    {613, 11, 0x11}, /*"@"*/
+    {648, 12, 0x11}, /*"A"*/
+    {672, 11, 0x11}, /*"B"*/
+    {708, 10, 0x11}, /*"C"*/
+    {735, 11, 0x11}, /*"D"*/
+    {766, 11, 0x11}, /*"E"*/
+    {800, 11, 0x11}, /*"F"*/
+    {828, 11, 0x11}, /*"G"*/
+    {859, 12, 0x11}, /*"H"*/
+    {890, 8, 0x11}, /*"I"*/
+    {911, 11, 0x11}, /*"J"*/
+    {934, 12, 0x11}, /*"K"*/
+    {965, 11, 0x11}, /*"L"*/
+    {987, 12, 0x11}, /*"M"*/
+    {1020, 12, 0x11}, /*"N"*/
+    {1046, 10, 0x11}, /*"O"*/
+    {1073, 11, 0x11}, /*"P"*/
+    {1103, 10, 0x11}, /*"Q"*/
+    {1130, 12, 0x11}, /*"R"*/
+    {1165, 10, 0x11}, /*"S"*/
+    {1199, 12, 0x11}, /*"T"*/
+    {1224, 12, 0x11}, /*"U"*/
+    {1249, 12, 0x11}, /*"V"*/
+    {1274, 12, 0x11}, /*"W"*/
+    {1304, 10, 0x11}, /*"X"*/
+    {1331, 12, 0x11}, /*"Y"*/
+    {1358, 10, 0x11}, /*"Z"*/
+    {1387, 6, 0x11}, /*"["*/
+    {1403, 9, 0x11}, /*"\"*/
+    {1417, 6, 0x11}, /*"]"*/
+    {1433, 7, 0x11}, /*"^"*/
+    {1443, 12, 0x11}, /*"_"*/
+    {1460, 4, 0x11}, /*"`"*/
+    {1466, 11, 0x11}, /*"a"*/
+    {1490, 10, 0x11}, /*"b"*/
+    {1515, 9, 0x11}, /*"c"*/
+    {1536, 10, 0x11}, /*"d"*/
+    {1562, 9, 0x11}, /*"e"*/
+    {1584, 10, 0x11}, /*"f"*/
+    {1611, 11, 0x11}, /*"g"*/
+    {1636, 10, 0x11}, /*"h"*/
+    {1659, 8, 0x11}, /*"i"*/
+    {1677, 7, 0x11}, /*"j"*/
+    {1694, 10, 0x11}, /*"k"*/
+    {1718, 8, 0x11}, /*"l"*/
+    {1736, 12, 0x11}, /*"m"*/
+    {1762, 10, 0x11}, /*"n"*/
+    {1783, 10, 0x11}, /*"o"*/
+    {1807, 10, 0x11}, /*"p"*/
+    {1831, 10, 0x11}, /*"q"*/
+    {1854, 11, 0x11}, /*"r"*/
+    {1878, 9, 0x11}, /*"s"*/
+    {1900, 9, 0x11}, /*"t"*/
+    {1919, 10, 0x11}, /*"u"*/
+    {1938, 11, 0x11}, /*"v"*/
+    {1957, 12, 0x11}, /*"w"*/
+    {1979, 10, 0x11}, /*"x"*/
+    {2003, 10, 0x11}, /*"y"*/
+    {2022, 9, 0x11}, /*"z"*/
+    {2043, 5, 0x11}, /*"{"*/
+    {2054, 1, 0x11}, /*"|"*/
+    {2058, 5, 0x11}, /*"}"*/
+    {2069, 11, 0x11}, /*"~"*/
 };
 
-const ASCIIFont afont16x8 = {16, 8, (unsigned char *)ascii_16x8};
-
-const unsigned char ascii_24x12[][36] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*" ",0*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00}, /*"!",1*/
-    {0x00, 0x00, 0x80, 0x60, 0x30, 0x1C, 0x8C, 0x60, 0x30, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*""",2*/
-    {0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x86, 0xE6, 0x9F, 0x86, 0x86, 0x86, 0x86, 0xE6, 0x9F, 0x86, 0x00, 0x00, 0x01, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x00}, /*"#",3*/
-    {0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0xF8, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0C, 0x18, 0xFF, 0x70, 0xE1, 0x81, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x10, 0x10, 0x7F, 0x10, 0x0F, 0x07, 0x00, 0x00}, /*"$",4*/
-    {0x80, 0x60, 0x20, 0x60, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x20, 0x00, 0x00, 0x0F, 0x30, 0x20, 0x30, 0x9F, 0x70, 0xDC, 0x37, 0x10, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x03, 0x00, 0x07, 0x18, 0x10, 0x18, 0x07, 0x00}, /*"%",5*/
-    {0x00, 0x00, 0xC0, 0x20, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x1F, 0x38, 0xE8, 0x87, 0x03, 0xC4, 0x3C, 0x04, 0x00, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x0B, 0x07, 0x0D, 0x10, 0x10, 0x08, 0x00}, /*"&",6*/
-    {0x00, 0x80, 0x8C, 0x4C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"'",7*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x30, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x18, 0x20, 0x40, 0x00}, /*"(",8*/
-    {0x00, 0x04, 0x08, 0x30, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x18, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*")",9*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x66, 0x66, 0x3C, 0x18, 0xFF, 0x18, 0x3C, 0x66, 0x66, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"*",10*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"+",11*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8C, 0x4C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*",",12*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"-",13*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*".",14*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"/",15*/
-    {0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x18, 0x0E, 0x07, 0x01, 0x00}, /*"0",16*/
-    {0x00, 0x00, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x00, 0x00}, /*"1",17*/
-    {0x00, 0x80, 0x40, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x80, 0x40, 0x20, 0x38, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x1C, 0x1A, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x00, 0x00}, /*"2",18*/
-    {0x00, 0x80, 0xC0, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x10, 0x10, 0x18, 0x2F, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, 0x00, 0x00}, /*"3",19*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0, 0x88, 0x86, 0x81, 0x80, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x00}, /*"4",20*/
-    {0x00, 0x00, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0x08, 0x08, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x0F, 0x03, 0x00, 0x00}, /*"5",21*/
-    {0x00, 0x00, 0x80, 0xC0, 0x40, 0x20, 0x20, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x21, 0x10, 0x08, 0x08, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x00, 0x01, 0x07, 0x0C, 0x18, 0x10, 0x10, 0x10, 0x08, 0x0F, 0x03, 0x00}, /*"6",22*/
-    {0x00, 0x00, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"7",23*/
-    {0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x87, 0xEF, 0x2C, 0x18, 0x18, 0x30, 0x30, 0x68, 0xCF, 0x83, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, 0x00}, /*"8",24*/
-    {0x00, 0x00, 0xC0, 0xC0, 0x20, 0x20, 0x20, 0x20, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x40, 0x20, 0x10, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0C, 0x1C, 0x10, 0x10, 0x10, 0x08, 0x0F, 0x03, 0x00, 0x00}, /*"9",25*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00}, /*":",26*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00}, /*";",27*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x00, 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}, /*"<",28*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"=",29*/
-    {0x00, 0x00, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x44, 0x28, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}, /*">",30*/
-    {0x00, 0xC0, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x30, 0xE0, 0xC0, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xF0, 0x10, 0x08, 0x0C, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"?",31*/
-    {0x00, 0x00, 0x00, 0xC0, 0x40, 0x60, 0x20, 0x20, 0x20, 0x40, 0xC0, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0xF0, 0x0E, 0x03, 0xC1, 0xFE, 0x03, 0x80, 0x7F, 0x00, 0x01, 0x07, 0x0E, 0x08, 0x11, 0x11, 0x10, 0x11, 0x09, 0x04, 0x02}, /*"@",32*/
-    {0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7C, 0x43, 0x40, 0x47, 0x7F, 0xF8, 0x80, 0x00, 0x00, 0x10, 0x18, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1F, 0x1C, 0x10}, /*"A",33*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x18, 0x2F, 0xE7, 0x80, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, 0x00}, /*"B",34*/
-    {0x00, 0x00, 0x80, 0xC0, 0x40, 0x20, 0x20, 0x20, 0x20, 0x60, 0xE0, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x10, 0x08, 0x04, 0x03, 0x00}, /*"C",35*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x18, 0x08, 0x0E, 0x07, 0x01, 0x00}, /*"D",36*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x06, 0x00}, /*"E",37*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x60, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x01, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"F",38*/
-    {0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x20, 0x40, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x40, 0x40, 0xC0, 0xC1, 0x40, 0x40, 0x00, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x10, 0x0F, 0x0F, 0x00, 0x00}, /*"G",39*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0xE0, 0x20, 0x00, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10}, /*"H",40*/
-    {0x00, 0x00, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x00, 0x00}, /*"I",41*/
-    {0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0x7F, 0x3F, 0x00, 0x00, 0x00}, /*"J",42*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x00, 0x00, 0x20, 0xA0, 0x60, 0x20, 0x20, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x18, 0x7C, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x01, 0x13, 0x1F, 0x1C, 0x18, 0x10}, /*"K",43*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x06, 0x00}, /*"L",44*/
-    {0x20, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x20, 0x00, 0xFF, 0x01, 0x3F, 0xFE, 0xC0, 0xE0, 0x1E, 0x01, 0xFF, 0xFF, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x03, 0x1F, 0x03, 0x00, 0x10, 0x1F, 0x1F, 0x10}, /*"M",45*/
-    {0x20, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0x20, 0x00, 0xFF, 0x00, 0x03, 0x07, 0x1C, 0x78, 0xE0, 0x80, 0x00, 0xFF, 0x00, 0x10, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x00}, /*"N",46*/
-    {0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x18, 0x0C, 0x07, 0x01, 0x00}, /*"O",47*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x1F, 0x0F, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"P",48*/
-    {0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x07, 0x0E, 0x11, 0x11, 0x13, 0x3C, 0x7C, 0x67, 0x21, 0x00}, /*"Q",49*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x10, 0x10, 0x30, 0xF0, 0xD0, 0x08, 0x0F, 0x07, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x1C, 0x10, 0x10}, /*"R",50*/
-    {0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0xE0, 0x00, 0x00, 0x07, 0x0F, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0xE0, 0x81, 0x00, 0x00, 0x1F, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07, 0x00}, /*"S",51*/
-    {0x80, 0x60, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x60, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00}, /*"T",52*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0x20, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x07, 0x00}, /*"U",53*/
-    {0x20, 0x60, 0xE0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x20, 0xE0, 0x60, 0x20, 0x00, 0x00, 0x07, 0x7F, 0xF8, 0x80, 0x00, 0x80, 0x7C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00}, /*"V",54*/
-    {0x20, 0xE0, 0xE0, 0x20, 0x00, 0xE0, 0xE0, 0x20, 0x00, 0x20, 0xE0, 0x20, 0x00, 0x07, 0xFF, 0xF8, 0xE0, 0x1F, 0xFF, 0xFC, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x03, 0x00, 0x01, 0x1F, 0x03, 0x00, 0x00, 0x00}, /*"W",55*/
-    {0x00, 0x20, 0x60, 0xE0, 0xA0, 0x00, 0x00, 0x20, 0xE0, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8F, 0x7C, 0xF8, 0xC6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1E, 0x13, 0x00, 0x01, 0x17, 0x1F, 0x18, 0x10, 0x00}, /*"X",56*/
-    {0x20, 0x60, 0xE0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x20, 0xE0, 0x60, 0x20, 0x00, 0x00, 0x01, 0x07, 0x3E, 0xF8, 0xE0, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x00, 0x00, 0x00}, /*"Y",57*/
-    {0x00, 0x80, 0x60, 0x20, 0x20, 0x20, 0x20, 0xA0, 0xE0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0x3E, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x1F, 0x17, 0x10, 0x10, 0x10, 0x10, 0x18, 0x06, 0x00}, /*"Z",58*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00}, /*"[",59*/
-    {0x00, 0x00, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1C, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x70, 0x80, 0x00}, /*"\",60*/
-    {0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x00}, /*"]",61*/
-    {0x00, 0x00, 0x00, 0x10, 0x08, 0x0C, 0x04, 0x0C, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"^",62*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, /*"_",63*/
-    {0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"`",64*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xD8, 0x44, 0x64, 0x24, 0x24, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x18, 0x10, 0x10, 0x10, 0x08, 0x1F, 0x1F, 0x10, 0x18}, /*"a",65*/
-    {0x00, 0x20, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x18, 0x08, 0x04, 0x04, 0x0C, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x03, 0x00}, /*"b",66*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0x18, 0x04, 0x04, 0x04, 0x3C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x0C, 0x10, 0x10, 0x10, 0x10, 0x08, 0x06, 0x00, 0x00}, /*"c",67*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0x1C, 0x04, 0x04, 0x04, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x18, 0x10, 0x10, 0x10, 0x08, 0x1F, 0x0F, 0x08, 0x00}, /*"d",68*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0x48, 0x44, 0x44, 0x44, 0x4C, 0x78, 0x70, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x0C, 0x18, 0x10, 0x10, 0x10, 0x08, 0x04, 0x00}, /*"e",69*/
-    {0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0x04, 0x04, 0x04, 0xFF, 0xFF, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00}, /*"f",70*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF8, 0x8C, 0x04, 0x04, 0x8C, 0xF8, 0x74, 0x04, 0x0C, 0x00, 0x70, 0x76, 0xCF, 0x8D, 0x8D, 0x8D, 0x89, 0xC8, 0x78, 0x70, 0x00}, /*"g",71*/
-    {0x00, 0x20, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0x04, 0x04, 0x04, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00}, /*"h",72*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x00, 0x00}, /*"i",73*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0x7F, 0x3F, 0x00, 0x00, 0x00}, /*"j",74*/
-    {0x00, 0x20, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xC0, 0xF4, 0x1C, 0x04, 0x04, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x11, 0x00, 0x03, 0x1F, 0x1C, 0x10, 0x10, 0x00}, /*"k",75*/
-    {0x00, 0x00, 0x20, 0x20, 0x20, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x00, 0x00}, /*"l",76*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0xFC, 0x08, 0x04, 0xFC, 0xFC, 0x08, 0x04, 0xFC, 0xFC, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x1F, 0x1F, 0x10, 0x00, 0x1F, 0x1F, 0x10}, /*"m",77*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0xFC, 0x08, 0x08, 0x04, 0x04, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00}, /*"n",78*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0x18, 0x0C, 0x04, 0x04, 0x0C, 0x18, 0xF0, 0xE0, 0x00, 0x00, 0x03, 0x0F, 0x0C, 0x10, 0x10, 0x10, 0x10, 0x0C, 0x0F, 0x03, 0x00}, /*"o",79*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0xFC, 0x08, 0x04, 0x04, 0x04, 0x0C, 0xF8, 0xF0, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x88, 0x90, 0x10, 0x10, 0x1C, 0x0F, 0x03, 0x00}, /*"p",80*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0x1C, 0x04, 0x04, 0x04, 0x08, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x18, 0x10, 0x10, 0x90, 0x88, 0xFF, 0xFF, 0x80, 0x00}, /*"q",81*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0xFC, 0xFC, 0x10, 0x08, 0x04, 0x04, 0x0C, 0x0C, 0x00, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00}, /*"r",82*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0xCC, 0xC4, 0x84, 0x84, 0x84, 0x0C, 0x1C, 0x00, 0x00, 0x00, 0x1E, 0x18, 0x10, 0x10, 0x10, 0x11, 0x19, 0x0F, 0x06, 0x00}, /*"s",83*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0xFF, 0xFF, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x0C, 0x00, 0x00}, /*"t",84*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x18, 0x10, 0x10, 0x08, 0x1F, 0x0F, 0x08, 0x00}, /*"u",85*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x3C, 0xFC, 0xC4, 0x00, 0x00, 0xC4, 0x3C, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x1E, 0x0E, 0x01, 0x00, 0x00, 0x00}, /*"v",86*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3C, 0xFC, 0xC4, 0x00, 0xE4, 0x7C, 0xFC, 0x84, 0x80, 0x7C, 0x04, 0x00, 0x00, 0x07, 0x1F, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x07, 0x00, 0x00}, /*"w",87*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1C, 0x7C, 0xE4, 0xC0, 0x34, 0x1C, 0x04, 0x04, 0x00, 0x00, 0x10, 0x10, 0x1C, 0x16, 0x01, 0x13, 0x1F, 0x1C, 0x18, 0x10, 0x00}, /*"x",88*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x3C, 0xFC, 0xC4, 0x00, 0xC4, 0x3C, 0x04, 0x04, 0x00, 0x00, 0x00, 0xC0, 0x80, 0xC1, 0x37, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00}, /*"y",89*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x04, 0x04, 0xC4, 0xF4, 0x7C, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x1F, 0x17, 0x11, 0x10, 0x10, 0x18, 0x0E, 0x00}, /*"z",90*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x60, 0x40, 0x00, 0x00}, /*"{",91*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"|",92*/
-    {0x00, 0x00, 0x04, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"}",93*/
-    {0x00, 0x18, 0x06, 0x02, 0x02, 0x04, 0x08, 0x10, 0x20, 0x20, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /*"~",94*/                                                                                                                                                                                                                /*"~",94*/
+const ASCIIKern ascii_24x12_kern[] = {
+    {',', 'T', -1},
+    {',', 'V', -1},
+    {'.', 'T', -1},
+    {'.', 'V', -1},
+    {'A', 'T', -1},
+    {'A', 'V', -2},
+    {'F', ',', -3},
+    {'F', '.', -3},
+    {'F', 'A', -1},
+    {'L', 'T', -2},
+    {'L', 'V', -1},
+    {'L', 'Y', -1},
+    {'P', ',', -3},
+    {'P', '.', -3},
+    {'T', ',', -2},
+    {'T', '.', -1},
+    {'T', 'A', -1},
+    {'V', ',', -2},
+    {'V', '.', -1},
+    {'V', 'A', -2},
+    {'W', ',', -1},
+    {'W', 'A', -1},
+    {'Y', ',', -1},
 };
 
-const ASCIIFont afont24x12 = {24, 12, (unsigned char *)ascii_24x12};
+const ASCIIFont afont24x12 = {24, 14, (unsigned char *)ascii_24x12_data, ascii_24x12_glyphs, ascii_24x12_kern, 23, 1, NULL};
+// ascii_prop.py: afont24x12 end
 
 const uint8_t zh16x16[][36] = {
-/* 0 波 */ {0xe6,0xb3,0xa2,0x00,0x10,0x60,0x02,0x0c,0xc0,0x00,0xf8,0x88,0x88,0x88,0xff,0x88,0x88,0xa8,0x18,0x00,0x04,0x04,0x7c,0x03,0x80,0x60,0x1f,0x80,0x43,0x2c,0x10,0x28,0x46,0x81,0x80,0x00,},
-/* 1 特 */ {0xe7,0x89,0xb9,0x00,0x40,0x3c,0x10,0xff,0x10,0x10,0x40,0x48,0x48,0x48,0x7f,0x48,0xc8,0x48,0x40,0x00,0x02,0x06,0x02,0xff,0x01,0x01,0x00,0x02,0x0a,0x12,0x42,0x82,0x7f,0x02,0x02,0x00,},
-/* 2 律 */ {0xe5,0xbe,0x8b,0x00,0x00,0x10,0x88,0xc4,0x33,0x10,0x54,0x54,0x54,0xff,0x54,0x54,0x7c,0x10,0x10,0x00,0x02,0x01,0x00,0xff,0x00,0x10,0x12,0x12,0x12,0xff,0x12,0x12,0x12,0x10,0x00,0x00,},
-/* 3 动 */ {0xe5,0x8a,0xa8,0x00,0x40,0x44,0xc4,0x44,0x44,0x44,0x40,0x10,0x10,0xff,0x10,0x10,0x10,0xf0,0x00,0x00,0x10,0x3c,0x13,0x10,0x14,0xb8,0x40,0x30,0x0e,0x01,0x40,0x80,0x40,0x3f,0x00,0x00,}
+/* 0 动 */ {0xe5,0x8a,0xa8,0x00,0x40,0x44,0xc4,0x44,0x44,0x44,0x40,0x10,0x10,0xff,0x10,0x10,0x10,0xf0,0x00,0x00,0x10,0x3c,0x13,0x10,0x14,0xb8,0x40,0x30,0x0e,0x01,0x40,0x80,0x40,0x3f,0x00,0x00,},
+/* 1 律 */ {0xe5,0xbe,0x8b,0x00,0x00,0x10,0x88,0xc4,0x33,0x10,0x54,0x54,0x54,0xff,0x54,0x54,0x7c,0x10,0x10,0x00,0x02,0x01,0x00,0xff,0x00,0x10,0x12,0x12,0x12,0xff,0x12,0x12,0x12,0x10,0x00,0x00,},
+/* 2 波 */ {0xe6,0xb3,0xa2,0x00,0x10,0x60,0x02,0x0c,0xc0,0x00,0xf8,0x88,0x88,0x88,0xff,0x88,0x88,0xa8,0x18,0x00,0x04,0x04,0x7c,0x03,0x80,0x60,0x1f,0x80,0x43,0x2c,0x10,0x28,0x46,0x81,0x80,0x00,},
+/* 3 特 */ {0xe7,0x89,0xb9,0x00,0x40,0x3c,0x10,0xff,0x10,0x10,0x40,0x48,0x48,0x48,0x7f,0x48,0xc8,0x48,0x40,0x00,0x02,0x06,0x02,0xff,0x01,0x01,0x00,0x02,0x0a,0x12,0x42,0x82,0x7f,0x02,0x02,0x00,}
 };
-const Font font16x16 = {16, 16, (const uint8_t *)zh16x16, 4, &afont16x8};
+const Font font16x16 = {16, 16, (const uint8_t *)zh16x16, 4, &afont16x8, 1};
 
 const uint8_t bilibiliData[] = {
 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x86, 0x8f, 0x9f, 0xbf, 0xff, 0xfc, 0xf8, 0xf8, 0xe0, 0xe0, 0xc0, 0x80,
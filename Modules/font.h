@@ -2,12 +2,46 @@
 #define __FONT_H
 #include "stdint.h"
 #include "string.h"
+/**
+ * @brief 比例字体中一个字符的信息
+ * @note 前进量(光标移动的距离) = 左留白 + w + 右留白
+ */
+typedef struct ASCIIGlyph {
+  uint16_t offset; // 字模在chars中的位置 字模按页排列, 每页w字节
+  uint8_t w;       // 字模宽度
+  uint8_t bearing; // 高4位: 左留白 低4位: 右留白
+} ASCIIGlyph;
+
+/**
+ * @brief 字距调整 left后面紧跟right时, right移动adjust像素(负数为左移)
+ */
+typedef struct ASCIIKern {
+  char left;
+  char right;
+  int8_t adjust;
+} ASCIIKern;
+
+/**
+ * @brief ASCII字体 (从' '到'~')
+ * @note glyphs为NULL时是等宽字体, 每个字模 ((h + 7) / 8) * w 字节;
+ *       否则是比例字体, 由scripts/font_converter/ascii_prop.py生成
+ * @note packed为1时字模是压缩的 (scripts/font_converter/glyph_pack.py):
+ *       每个字模为 非零字节掩码((字节数 + 7) / 8 字节) + 非零字节
+ */
 typedef struct ASCIIFont {
   uint8_t h;
-  uint8_t w;
+  uint8_t w;                // 字宽度 比例字体为最大前进量
   uint8_t *chars;
+  const ASCIIGlyph *glyphs; // 比例字体的字符信息
+  const ASCIIKern *kern;    // 字距调整表 按(left, right)升序排列, 可以为NULL
+  uint16_t kernCount;       // 字距调整表长度
+  uint8_t packed;           // 1: 字模是压缩的
+  const uint16_t *index;    // 压缩的等宽字体: 每ASCII_PACK_INDEX_STEP个字中第一个字在chars中的位置
 } ASCIIFont;
 
+// 压缩的等宽字体的索引间隔 (与scripts/font_converter/glyph_pack.py中的INDEX_STEP相同)
+#define ASCII_PACK_INDEX_STEP 4
+
 extern const ASCIIFont afont8x6;
 extern const ASCIIFont afont12x6;
 extern const ASCIIFont afont16x8;
@@ -22,8 +56,9 @@ typedef struct Font {
   uint8_t h;              // 字高度
   uint8_t w;              // 字宽度
   const uint8_t *chars;   // 字库 字库前4字节存储utf8编码 剩余字节存储字模数据
-  uint8_t len;            // 字库长度 超过256则请改为uint16_t
+  uint16_t len;           // 字库长度
   const ASCIIFont *ascii; // 缺省ASCII字体 当字库中没有对应字符且需要显示ASCII字符时使用
+  uint8_t sorted;         // 1: 字库按utf8编码升序排列(scripts/font_converter/font_sort.py), 用二分查找 0: 逐个比较
 } Font;
 
 extern const Font font16x16;
@@ -36,6 +71,7 @@ typedef struct Image {
   uint8_t w;           // 图片宽度
   uint8_t h;           // 图片高度
   const uint8_t *data; // 图片数据
+  const uint8_t *mask; // 透明掩码 排列与data相同, 1为不透明; NULL表示整张图不透明
 } Image;
 
 extern const Image bilibiliImg;
@@ -0,0 +1,198 @@
+/**
+ * @file font_pack.c
+ * @brief 外部Flash GBK字库的索引
+ * @note 开机时读一次字库头部(FontPack_Init), 之后取字地址只需要一次乘加.
+ * @note Flash中没有字库头部时按旧版字库处理: 只有16x16, 由旧的烧录程序分7次写入,
+ *       每次写入的起始地址是 FONT_LEGACY_PART_SIZE 的整数倍, 每个分卷中间不跨字,
+ *       所以分卷末尾各有一小段空隙.
+ */
+#include "font_pack.h"
+#include "crc32.h"
+#include "w25qxx.h"
+
+// 旧版字库: 每个分卷在Flash中占用的大小, 以及每个分卷中的字数
+#define FONT_LEGACY_PART_SIZE 37386
+#define FONT_LEGACY_PART_GLYPHS (FONT_LEGACY_PART_SIZE / 32)
+
+static FontPackHeader FontPack_Header;
+static uint8_t FontPack_Legacy;
+
+// 后台校验点阵数据 (FontPack_VerifyStep)
+static uint8_t FontPack_VerifyState = FONT_PACK_VERIFY_NONE;
+static uint32_t FontPack_VerifyPos;  // 已校验的字节数
+static uint32_t FontPack_VerifyLen;  // 点阵数据的总字节数
+static uint32_t FontPack_VerifyCrc;
+
+/**
+ * @brief 旧版字库: 16x16, GB2312全部区位(0xA1A1~0xF7FE)
+ */
+static void FontPack_SetLegacy(void)
+{
+  FontPackHeader *h = &FontPack_Header;
+
+  h->magic = 0;
+  h->version = 0;
+  h->glyphCount = (0xF7 - 0xA1 + 1) * 94;
+  h->sizeCount = 1;
+  h->rangeCount = 1;
+  h->headerSize = sizeof(FontPackHeader);
+  h->sizes[0].size = 16;
+  h->sizes[0].w = 16;
+  h->sizes[0].glyphBytes = 32;
+  h->sizes[0].offset = 0;
+  h->ranges[0].hiFirst = 0xA1;
+  h->ranges[0].hiLast = 0xF7;
+  h->ranges[0].loFirst = 0xA1;
+  h->ranges[0].loLast = 0xFE;
+  h->ranges[0].glyphBase = 0;
+  FontPack_Legacy = 1;
+}
+
+/**
+ * @brief 读取并检查字库头部
+ * @return 1:新格式字库 0:没有有效头部, 按旧版16x16字库处理
+ * @note 在W25Q_Init()之后调用一次
+ */
+uint8_t FontPack_Init(void)
+{
+  FontPackHeader *h = &FontPack_Header;
+
+  W25Q_Read((uint8_t *)h, FONT_PACK_ADDR, sizeof(FontPackHeader));
+  if (h->magic != FONT_PACK_MAGIC || h->version != FONT_PACK_VERSION ||
+      h->headerSize != sizeof(FontPackHeader) ||
+      h->sizeCount == 0 || h->sizeCount > FONT_PACK_MAX_SIZES ||
+      h->rangeCount == 0 || h->rangeCount > FONT_PACK_MAX_RANGES ||
+      h->headerCrc != Crc32(h, sizeof(FontPackHeader) - 4))
+  {
+    FontPack_SetLegacy();
+    FontPack_VerifyState = FONT_PACK_VERIFY_NONE; // 旧版字库没有CRC
+    return 0;
+  }
+  FontPack_Legacy = 0;
+
+  // 点阵数据紧接着依次排列, 在主循环空闲时分段校验
+  FontPack_VerifyLen = 0;
+  for (uint8_t i = 0; i < h->sizeCount; i++)
+    FontPack_VerifyLen += (uint32_t)h->glyphCount * h->sizes[i].glyphBytes;
+  FontPack_VerifyPos = 0;
+  FontPack_VerifyCrc = 0;
+  FontPack_VerifyState = FONT_PACK_VERIFY_RUNNING;
+  return 1;
+}
+
+/**
+ * @brief 校验一段点阵数据 (在主循环空闲时调用, 每次读 FONT_PACK_VERIFY_CHUNK 字节)
+ * @return 校验状态 FONT_PACK_VERIFY_xxx
+ * @note 全部数据的CRC32与头部的dataCrc比较. 12/16/24/32号的GB2312字库约2MB
+ *       (8178个字, 每个字4个字号共256字节), 大约要16000次调用
+ */
+uint8_t FontPack_VerifyStep(void)
+{
+  uint8_t buf[FONT_PACK_VERIFY_CHUNK];
+  uint32_t n;
+
+  if (FontPack_VerifyState != FONT_PACK_VERIFY_RUNNING)
+    return FontPack_VerifyState;
+
+  n = FontPack_VerifyLen - FontPack_VerifyPos;
+  if (n > sizeof(buf))
+    n = sizeof(buf);
+  // 直接连续读取, 不经过读缓存 (整个字库只读一遍, 放进缓存只会挤掉有用的数据)
+  W25Q_ReadStart(FONT_PACK_ADDR + FONT_PACK_DATA_OFFSET + FontPack_VerifyPos);
+  W25Q_ReadContinue(buf, n);
+  W25Q_ReadStop();
+  FontPack_VerifyCrc = Crc32_Update(FontPack_VerifyCrc, buf, n);
+  FontPack_VerifyPos += n;
+
+  if (FontPack_VerifyPos >= FontPack_VerifyLen)
+    FontPack_VerifyState = (FontPack_VerifyCrc == FontPack_Header.dataCrc) ? FONT_PACK_VERIFY_OK : FONT_PACK_VERIFY_BAD;
+  return FontPack_VerifyState;
+}
+
+/**
+ * @brief 点阵数据的校验状态
+ */
+uint8_t FontPack_GetVerifyState(void)
+{
+  return FontPack_VerifyState;
+}
+
+/**
+ * @brief 点阵数据已校验的百分比 (0~100)
+ */
+uint8_t FontPack_GetVerifyPercent(void)
+{
+  if (FontPack_VerifyLen == 0)
+    return 0;
+  return FontPack_VerifyPos * 100 / FontPack_VerifyLen; // Flash只有16MB, 乘100不会溢出
+}
+
+/**
+ * @brief 当前是否在使用旧版字库
+ */
+uint8_t FontPack_IsLegacy(void)
+{
+  return FontPack_Legacy;
+}
+
+/**
+ * @brief 查找字号
+ */
+static const FontPackSize *FontPack_FindSize(uint8_t size)
+{
+  for (uint8_t i = 0; i < FontPack_Header.sizeCount; i++)
+  {
+    if (FontPack_Header.sizes[i].size == size)
+      return &FontPack_Header.sizes[i];
+  }
+  return NULL;
+}
+
+/**
+ * @brief 计算一个字在外部Flash中的地址
+ * @param size 字号
+ * @param code GBK编码 (高字节<<8 | 低字节)
+ * @return 地址, 没有这个字号或这个字时返回FONT_PACK_NONE
+ */
+uint32_t FontPack_GetGlyphAddr(uint8_t size, uint16_t code)
+{
+  const FontPackSize *s = FontPack_FindSize(size);
+  const FontPackRange *r;
+  uint8_t hi = code >> 8;
+  uint8_t lo = code & 0xFF;
+  uint32_t index;
+
+  if (s == NULL)
+    return FONT_PACK_NONE;
+  for (uint8_t i = 0; i < FontPack_Header.rangeCount; i++)
+  {
+    r = &FontPack_Header.ranges[i];
+    if (hi < r->hiFirst || hi > r->hiLast || lo < r->loFirst || lo > r->loLast)
+      continue;
+    index = r->glyphBase + (uint32_t)(hi - r->hiFirst) * (r->loLast - r->loFirst + 1) + (lo - r->loFirst);
+    if (FontPack_Legacy)
+      return (index / FONT_LEGACY_PART_GLYPHS) * FONT_LEGACY_PART_SIZE + (index % FONT_LEGACY_PART_GLYPHS) * 32;
+    return FONT_PACK_ADDR + s->offset + index * s->glyphBytes;
+  }
+  return FONT_PACK_NONE;
+}
+
+/**
+ * @brief 某字号每个字的字节数
+ * @return 没有这个字号时返回0
+ */
+uint16_t FontPack_GetGlyphBytes(uint8_t size)
+{
+  const FontPackSize *s = FontPack_FindSize(size);
+  return s ? s->glyphBytes : 0;
+}
+
+/**
+ * @brief 某字号的点阵宽度
+ * @return 没有这个字号时返回0
+ */
+uint8_t FontPack_GetGlyphWidth(uint8_t size)
+{
+  const FontPackSize *s = FontPack_FindSize(size);
+  return s ? s->w : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef __FONT_PACK_H__
+#define __FONT_PACK_H__
+
+#include "stdint.h"
+
+/**
+ * 外部Flash中的GBK字库格式 (由 scripts/字库烧录/font_generater.py 生成, 两边必须保持一致)
+ *
+ * FONT_PACK_ADDR + 0    : FontPackHeader (小端, 不足256字节的部分填0xFF)
+ * FONT_PACK_ADDR + 256  : 各字号的点阵数据, 依次排列, 位置见 FontPackSize.offset
+ *
+ * 每个字号内按字的序号排列, 序号由编码范围表算出:
+ *   序号 = glyphBase + (高字节 - hiFirst) * (loLast - loFirst + 1) + (低字节 - loFirst)
+ * 点阵按页排列(与OLED_SetBlock相同): 每页w字节, 共(h+7)/8页
+ */
+
+#define FONT_PACK_ADDR 0x000000
+#define FONT_PACK_MAGIC 0x4B504E46 // "FNPK"
+#define FONT_PACK_VERSION 1
+#define FONT_PACK_DATA_OFFSET 256
+#define FONT_PACK_MAX_SIZES 4
+#define FONT_PACK_MAX_RANGES 4
+
+#define FONT_PACK_NONE 0xFFFFFFFF // 没有这个字号/这个字
+
+// 点阵数据的后台校验 (FontPack_VerifyStep)
+#define FONT_PACK_VERIFY_CHUNK 128 // 每次读取校验的字节数
+#define FONT_PACK_VERIFY_NONE 0    // 没有CRC可以校验 (旧版字库)
+#define FONT_PACK_VERIFY_RUNNING 1 // 正在校验
+#define FONT_PACK_VERIFY_OK 2      // 校验通过
+#define FONT_PACK_VERIFY_BAD 3     // CRC不一致, 字库需要重新烧录
+
+typedef struct FontPackSize {
+  uint8_t size;        // 字号 (点阵高度)
+  uint8_t w;           // 点阵宽度
+  uint16_t glyphBytes; // 每个字的字节数 w * ((size + 7) / 8)
+  uint32_t offset;     // 点阵数据相对FONT_PACK_ADDR的偏移
+} FontPackSize;
+
+typedef struct FontPackRange {
+  uint8_t hiFirst, hiLast; // 高字节(区)范围
+  uint8_t loFirst, loLast; // 低字节(位)范围
+  uint16_t glyphBase;      // 本范围第一个字的序号
+  uint16_t reserved;
+} FontPackRange;
+
+typedef struct FontPackHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t glyphCount; // 每个字号的字数
+  uint8_t sizeCount;
+  uint8_t rangeCount;
+  uint16_t headerSize; // sizeof(FontPackHeader)
+  FontPackSize sizes[FONT_PACK_MAX_SIZES];
+  FontPackRange ranges[FONT_PACK_MAX_RANGES];
+  uint32_t dataCrc;   // 全部点阵数据的CRC32, 开机后在主循环空闲时分段校验 (FontPack_VerifyStep)
+  uint32_t headerCrc; // 前面所有字节的CRC32
+} FontPackHeader;
+
+uint8_t FontPack_Init(void);
+uint8_t FontPack_IsLegacy(void);
+uint8_t FontPack_VerifyStep(void);
+uint8_t FontPack_GetVerifyState(void);
+uint8_t FontPack_GetVerifyPercent(void);
+uint32_t FontPack_GetGlyphAddr(uint8_t size, uint16_t code);
+uint16_t FontPack_GetGlyphBytes(uint8_t size);
+uint8_t FontPack_GetGlyphWidth(uint8_t size);
+
+#endif // __FONT_PACK_H__
@@ -0,0 +1,320 @@
+/**
+ * @file glyph_cache.c
+ * @brief 外部Flash汉字点阵的RAM缓存
+ * @note 菜单、消息等界面每帧都重画同样的几十个汉字, 每个字从W25Q读一次要35字节以上的SPI传输.
+ *       这里把最近用过的字留在RAM里, 稳定的界面上取字几乎不花时间.
+ * @note 12/16号字和24/32号字大小相差4倍, 分成两个缓存池, 各自按最大的字分配空间.
+ * @note 点阵从Flash直接读出(W25Q_ReadDirect), 不经过Flash读缓存: 这里已经缓存了, 再经过它
+ *       每个字要多读一整行(256字节), 还会把说明书文字等需要它的数据挤掉.
+ * @note 淘汰用CLOCK(二次机会)算法: 每个字有一个访问位, 命中时置1;
+ *       需要空位时指针循环扫描, 访问位为1的清0跳过, 遇到为0的就淘汰. 效果接近LRU, 但不用维护链表.
+ * @note 批量预取: 先把一段文字(或几行文字)要用的字全部登记(BatchAdd), 再一次取齐(BatchFetch):
+ *       缺的字直接读进各自的缓存位置. 批次内的字被钉住, 在BatchEnd之前不会被淘汰, 绘制时一定命中,
+ *       一行里前面的字不会被后面的字挤掉.
+ */
+#include "glyph_cache.h"
+#include "w25qxx.h"
+
+// 访问位的取值
+#define GLYPH_REF_NONE 0   // 可以淘汰
+#define GLYPH_REF_USED 1   // 最近用过 淘汰前再给一次机会
+#define GLYPH_REF_PINNED 2 // 在当前批次中 不能淘汰
+#define GLYPH_REF_FRESH 3  // 在当前批次中刚读入 第一次取用不算命中
+
+typedef struct GlyphPool {
+  uint8_t *data;   // slots * bytes
+  uint16_t *code;  // GBK编码 0表示空位(GBK汉字编码都大于0xA1A1)
+  uint8_t *size;   // 字号
+  uint8_t *ref;    // 访问位
+  uint16_t slots;
+  uint16_t bytes;
+  uint16_t hand;   // CLOCK指针
+  uint16_t pinned; // 被钉住的字数
+} GlyphPool;
+
+typedef struct GlyphRequest {
+  uint32_t addr;
+  uint16_t code;
+  uint16_t bytes;
+  uint8_t size;
+} GlyphRequest;
+
+#if GLYPH_CACHE_SIZE > 0
+static uint8_t GlyphCache_Data[GLYPH_CACHE_SIZE][GLYPH_CACHE_BYTES];
+static uint16_t GlyphCache_Code[GLYPH_CACHE_SIZE];
+static uint8_t GlyphCache_Size[GLYPH_CACHE_SIZE];
+static uint8_t GlyphCache_Ref[GLYPH_CACHE_SIZE];
+static GlyphPool GlyphCache_Small = {&GlyphCache_Data[0][0], GlyphCache_Code, GlyphCache_Size, GlyphCache_Ref,
+                                     GLYPH_CACHE_SIZE, GLYPH_CACHE_BYTES, 0, 0};
+#endif
+
+#if GLYPH_CACHE_LARGE_SIZE > 0
+static uint8_t GlyphCache_LargeData[GLYPH_CACHE_LARGE_SIZE][GLYPH_CACHE_LARGE_BYTES];
+static uint16_t GlyphCache_LargeCode[GLYPH_CACHE_LARGE_SIZE];
+static uint8_t GlyphCache_LargeSize[GLYPH_CACHE_LARGE_SIZE];
+static uint8_t GlyphCache_LargeRef[GLYPH_CACHE_LARGE_SIZE];
+static GlyphPool GlyphCache_Large = {&GlyphCache_LargeData[0][0], GlyphCache_LargeCode, GlyphCache_LargeSize, GlyphCache_LargeRef,
+                                     GLYPH_CACHE_LARGE_SIZE, GLYPH_CACHE_LARGE_BYTES, 0, 0};
+#endif
+
+#if GLYPH_CACHE_SIZE == 0 || GLYPH_CACHE_LARGE_SIZE == 0
+static uint8_t GlyphCache_Buffer[GLYPH_CACHE_LARGE_BYTES]; // 不缓存时的读取缓冲区
+#endif
+
+static uint32_t GlyphCache_Hits;
+static uint32_t GlyphCache_Misses;
+
+static GlyphRequest GlyphBatch_List[GLYPH_BATCH_SIZE];
+static uint8_t GlyphBatch_Count;   // 已登记的字数
+static uint8_t GlyphBatch_Fetched; // 其中已经取过的字数
+static uint8_t GlyphBatch_Depth;   // BatchBegin的嵌套层数
+
+/**
+ * @brief 在缓存池中查找
+ * @return 位置, 没有时返回slots
+ */
+static uint16_t GlyphPool_Find(GlyphPool *pool, uint8_t size, uint16_t code)
+{
+  uint16_t i;
+  for (i = 0; i < pool->slots; i++)
+  {
+    if (pool->code[i] == code && pool->size[i] == size)
+      break;
+  }
+  return i;
+}
+
+/**
+ * @brief 淘汰一个字, 腾出位置
+ * @note 调用者保证至少有一个位置没有被钉住
+ */
+static uint16_t GlyphPool_Evict(GlyphPool *pool)
+{
+  uint16_t i;
+
+  // 找一个访问位为0的位置, 钉住的跳过
+  while (pool->ref[pool->hand] != GLYPH_REF_NONE)
+  {
+    if (pool->ref[pool->hand] == GLYPH_REF_USED)
+      pool->ref[pool->hand] = GLYPH_REF_NONE;
+    if (++pool->hand >= pool->slots)
+      pool->hand = 0;
+  }
+  i = pool->hand;
+  if (++pool->hand >= pool->slots)
+    pool->hand = 0;
+  return i;
+}
+
+/**
+ * @brief 在缓存池中查找, 未命中时淘汰一个字并从Flash读入
+ */
+static const uint8_t *GlyphPool_Get(GlyphPool *pool, uint8_t size, uint16_t code, uint32_t addr, uint16_t bytes)
+{
+  uint16_t i = GlyphPool_Find(pool, size, code);
+
+  if (i < pool->slots)
+  {
+    if (pool->ref[i] == GLYPH_REF_FRESH)
+      pool->ref[i] = GLYPH_REF_PINNED; // 预取时已经算过未命中
+    else
+    {
+      if (pool->ref[i] != GLYPH_REF_PINNED)
+        pool->ref[i] = GLYPH_REF_USED;
+      GlyphCache_Hits++;
+    }
+    return pool->data + i * pool->bytes;
+  }
+
+  i = GlyphPool_Evict(pool);
+  W25Q_ReadDirect(pool->data + i * pool->bytes, addr, bytes); // 一个字一次连续读出, 不经过Flash读缓存
+  pool->code[i] = code;
+  pool->size[i] = size;
+  pool->ref[i] = GLYPH_REF_USED;
+  GlyphCache_Misses++;
+  return pool->data + i * pool->bytes;
+}
+
+/**
+ * @brief 解除缓存池中所有字的钉住状态
+ */
+static void GlyphPool_Unpin(GlyphPool *pool)
+{
+  for (uint16_t i = 0; i < pool->slots; i++)
+  {
+    if (pool->ref[i] >= GLYPH_REF_PINNED)
+      pool->ref[i] = GLYPH_REF_USED;
+  }
+  pool->pinned = 0;
+}
+
+/**
+ * @brief 字的大小对应的缓存池
+ * @return 不缓存时返回NULL
+ */
+static GlyphPool *GlyphCache_Pool(uint16_t bytes)
+{
+  if (bytes <= GLYPH_CACHE_BYTES)
+  {
+#if GLYPH_CACHE_SIZE > 0
+    return &GlyphCache_Small;
+#endif
+  }
+  else
+  {
+#if GLYPH_CACHE_LARGE_SIZE > 0
+    return &GlyphCache_Large;
+#endif
+  }
+  return NULL;
+}
+
+/**
+ * @brief 清空缓存池
+ */
+static void GlyphPool_Clear(GlyphPool *pool)
+{
+  for (uint16_t i = 0; i < pool->slots; i++)
+  {
+    pool->code[i] = 0;
+    pool->ref[i] = 0;
+  }
+  pool->hand = 0;
+  pool->pinned = 0;
+}
+
+/**
+ * @brief 取一个汉字的点阵
+ * @param size 字号
+ * @param code GBK编码 (高字节<<8 | 低字节)
+ * @param addr 该字在外部Flash中的地址, 未命中时从这里读
+ * @param bytes 该字的字节数, 不超过GLYPH_CACHE_LARGE_BYTES
+ * @return 点阵数据, 在下一次调用GlyphCache_Get之前有效
+ */
+const uint8_t *GlyphCache_Get(uint8_t size, uint16_t code, uint32_t addr, uint16_t bytes)
+{
+  GlyphPool *pool = GlyphCache_Pool(bytes);
+
+  if (pool)
+    return GlyphPool_Get(pool, size, code, addr, bytes);
+#if GLYPH_CACHE_SIZE == 0 || GLYPH_CACHE_LARGE_SIZE == 0
+  W25Q_ReadDirect(GlyphCache_Buffer, addr, bytes);
+  GlyphCache_Misses++;
+  return GlyphCache_Buffer;
+#else
+  return NULL;
+#endif
+}
+
+/**
+ * @brief 开始一批预取
+ * @note 可以嵌套: 外层登记的字和内层登记的字在同一批中取, 到最外层BatchEnd才解除钉住
+ */
+void GlyphCache_BatchBegin(void)
+{
+  GlyphBatch_Depth++;
+}
+
+/**
+ * @brief 登记一个要用的字
+ * @note 参数与GlyphCache_Get相同; 重复的字只登记一次, 批次已满时忽略(绘制时再单独读取)
+ */
+void GlyphCache_BatchAdd(uint8_t size, uint16_t code, uint32_t addr, uint16_t bytes)
+{
+  GlyphRequest *req;
+
+  if (GlyphBatch_Depth == 0 || GlyphCache_Pool(bytes) == NULL)
+    return;
+  for (uint8_t i = 0; i < GlyphBatch_Count; i++)
+  {
+    if (GlyphBatch_List[i].code == code && GlyphBatch_List[i].size == size)
+      return;
+  }
+  if (GlyphBatch_Count >= GLYPH_BATCH_SIZE)
+    return;
+  req = &GlyphBatch_List[GlyphBatch_Count++];
+  req->addr = addr;
+  req->code = code;
+  req->size = size;
+  req->bytes = bytes;
+}
+
+/**
+ * @brief 取齐所有已登记的字
+ * @note 已在缓存中的字直接钉住; 缺的字分配位置后从Flash读入并钉住
+ */
+void GlyphCache_BatchFetch(void)
+{
+  GlyphRequest *req;
+  GlyphPool *pool;
+  uint16_t i;
+
+  for (; GlyphBatch_Fetched < GlyphBatch_Count; GlyphBatch_Fetched++)
+  {
+    req = &GlyphBatch_List[GlyphBatch_Fetched];
+    pool = GlyphCache_Pool(req->bytes);
+    i = GlyphPool_Find(pool, req->size, req->code);
+    if (i < pool->slots && pool->ref[i] >= GLYPH_REF_PINNED)
+      continue;
+    if (pool->pinned + 1 >= pool->slots)
+      continue; // 至少留一个位置不钉住, 给单独读取用; 这个字绘制时再读
+    if (i < pool->slots)
+    {
+      pool->ref[i] = GLYPH_REF_PINNED;
+      pool->pinned++;
+      continue;
+    }
+    i = GlyphPool_Evict(pool);
+    W25Q_ReadDirect(pool->data + i * pool->bytes, req->addr, req->bytes);
+    pool->code[i] = req->code;
+    pool->size[i] = req->size;
+    pool->ref[i] = GLYPH_REF_FRESH;
+    pool->pinned++;
+    GlyphCache_Misses++;
+  }
+}
+
+/**
+ * @brief 结束一批预取
+ * @note 最外层结束时解除钉住, 清空登记表
+ */
+void GlyphCache_BatchEnd(void)
+{
+  if (GlyphBatch_Depth == 0 || --GlyphBatch_Depth > 0)
+    return;
+#if GLYPH_CACHE_SIZE > 0
+  GlyphPool_Unpin(&GlyphCache_Small);
+#endif
+#if GLYPH_CACHE_LARGE_SIZE > 0
+  GlyphPool_Unpin(&GlyphCache_Large);
+#endif
+  GlyphBatch_Count = 0;
+  GlyphBatch_Fetched = 0;
+}
+
+/**
+ * @brief 清空缓存和统计
+ * @note 重新烧录字库后调用
+ */
+void GlyphCache_Clear(void)
+{
+  GlyphBatch_Count = 0;
+  GlyphBatch_Fetched = 0;
+#if GLYPH_CACHE_SIZE > 0
+  GlyphPool_Clear(&GlyphCache_Small);
+#endif
+#if GLYPH_CACHE_LARGE_SIZE > 0
+  GlyphPool_Clear(&GlyphCache_Large);
+#endif
+  GlyphCache_Hits = 0;
+  GlyphCache_Misses = 0;
+}
+
+/**
+ * @brief 读取命中/未命中次数
+ */
+void GlyphCache_GetStats(uint32_t *hits, uint32_t *misses)
+{
+  *hits = GlyphCache_Hits;
+  *misses = GlyphCache_Misses;
+}
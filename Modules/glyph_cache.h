@@ -0,0 +1,40 @@
+#ifndef __GLYPH_CACHE_H__
+#define __GLYPH_CACHE_H__
+
+#include "stdint.h"
+
+// RAM预算: 默认 24 * 36 + 4 * 132 = 1392 字节. 各模块缓存的RAM合计见README.md "RAM占用"
+
+// 小字缓存(12/16号)的字数 每个字占 GLYPH_CACHE_BYTES + 4 字节RAM; 设为0则不缓存
+// 说明书一屏最多3行x8个16号字, 24个正好放下一屏
+#ifndef GLYPH_CACHE_SIZE
+#define GLYPH_CACHE_SIZE 24
+#endif
+
+// 大字缓存(24/32号)的字数 每个字占 GLYPH_CACHE_LARGE_BYTES + 4 字节RAM; 设为0则不缓存
+#ifndef GLYPH_CACHE_LARGE_SIZE
+#define GLYPH_CACHE_LARGE_SIZE 4
+#endif
+
+#define GLYPH_CACHE_BYTES 32        // 小字每个字的最大字节数 (16x16)
+#define GLYPH_CACHE_LARGE_BYTES 128 // 大字每个字的最大字节数 (32x32)
+
+// 一批最多预取的字数 每个占12字节RAM
+// 批次中的字都要钉在缓存里, 超过两个缓存池的字数之和也钉不住
+#ifndef GLYPH_BATCH_SIZE
+#if GLYPH_CACHE_SIZE + GLYPH_CACHE_LARGE_SIZE > 0
+#define GLYPH_BATCH_SIZE (GLYPH_CACHE_SIZE + GLYPH_CACHE_LARGE_SIZE)
+#else
+#define GLYPH_BATCH_SIZE 1
+#endif
+#endif
+
+const uint8_t *GlyphCache_Get(uint8_t size, uint16_t code, uint32_t addr, uint16_t bytes);
+void GlyphCache_BatchBegin(void);
+void GlyphCache_BatchAdd(uint8_t size, uint16_t code, uint32_t addr, uint16_t bytes);
+void GlyphCache_BatchFetch(void);
+void GlyphCache_BatchEnd(void);
+void GlyphCache_Clear(void);
+void GlyphCache_GetStats(uint32_t *hits, uint32_t *misses);
+
+#endif // __GLYPH_CACHE_H__
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "i2c.h"
 
-// MPU6050 ṹ
+// MPU6050 结构体
 typedef struct
 {
     int16_t Accel_X_RAW;
@@ -25,10 +25,10 @@ typedef struct
 
     double KalmanAngleX;
     double KalmanAngleY;
-    double KalmanAngleZ; //  Yaw 
+    double KalmanAngleZ; // 用于 Yaw 估算
 } MPU6050_t;
 
-// ṹ
+// 卡尔曼结构体
 typedef struct
 {
     double Q_angle;
@@ -39,12 +39,12 @@ typedef struct
     double P[2][2];
 } Kalman_t;
 
-// ---  ---
+// --- 基础驱动 ---
 uint8_t MPU6050_Init(I2C_HandleTypeDef *I2Cx);
 void MPU6050_Read_All(I2C_HandleTypeDef *I2Cx, MPU6050_t *DataStruct);
 
-// --- ϲӦýӿ ---
-void MPU6050_Update_Task(void); //  main while(1) е
-const MPU6050_t* MPU6050_GetDataPtr(void); //  UI ȡ
+// --- 新增：上层应用接口 ---
+void MPU6050_Update_Task(void); // 在 main while(1) 中调用
+const MPU6050_t* MPU6050_GetDataPtr(void); // 供 UI 获取数据
 
 #endif
\ No newline at end of file
@@ -12,44 +12,91 @@
  *
  * @note
  * 使用流程:
- * 1. STM32初始化IIC完成后调用OLED_Init()初始化OLED. 注意STM32启动比OLED上电快, 可等待20ms再初始化OLED
+ * 1. STM32初始化IIC完成后调用OLED_SetPort(&OLED_PortSTM32)选择底层接口, 再调用OLED_Init()初始化OLED. 注意STM32启动比OLED上电快, 可等待20ms再初始化OLED
  * 2. 调用OLED_NewFrame()开始绘制新的一帧
  * 3. 调用OLED_DrawXXX()系列函数绘制图形到显存 调用OLED_Printxxx()系列函数绘制文本到显存
  * 4. 调用OLED_ShowFrame()将显存内容显示到OLED
+ *    或调用OLED_ShowFrameAsync()在中断中后台发送, 发送期间可以继续绘制下一帧
  *
  * @note
  * 为保证中文显示正常 请将编译器的字符集设置为UTF-8
  *
  */
 #include "oled.h"
-#include "i2c.h"
+#include "oled_port.h"
+#include "glyph_cache.h"
+#include "font_pack.h"
 #include <math.h>
 #include <stdlib.h>
-#include "font_write.h"
 #define GBK_16_ADDR  0x00000000  // 从 0 开始  
-// OLED器件地址
-#define OLED_ADDRESS 0x78
-
 // OLED参数
 #define OLED_PAGE 8            // OLED页数
 #define OLED_ROW 8 * OLED_PAGE // OLED行数
 #define OLED_COLUMN 128        // OLED列数
-
-// 显存
-uint8_t OLED_GRAM[OLED_PAGE][OLED_COLUMN];
+#define OLED_COLUMN_OFFSET 2   // SH1106内部有132列, 1.3寸屏从第2列开始显示
+
+// 显存 外部模块请通过OLED_Draw*/OLED_SetBlock/画布访问
+static uint8_t OLED_GRAM[OLED_PAGE][OLED_COLUMN];
+
+// 影子显存 记录上一次已经发送到屏幕上的内容 OLED_ShowFrame()只发送与它不同的部分
+// 异步发送时它同时作为前台缓冲区: 发送的数据都从这里读取, OLED_GRAM(后台)可以继续绘制
+static uint8_t OLED_ShadowGRAM[OLED_PAGE][OLED_COLUMN];
+static uint8_t OLED_ShadowValid = 0; // 影子显存是否与屏幕内容一致 为0时下一帧全屏发送
+
+// 绘图目标 所有OLED_Draw*/OLED_Print*函数都画在它上面, 默认是屏幕显存
+static Canvas OLED_Screen = {OLED_COLUMN, OLED_ROW, &OLED_GRAM[0][0]};
+static Canvas *OLED_Target = &OLED_Screen;
+#define OLED_TARGET_PAGES ((OLED_Target->h + 7) / 8)
+#define OLED_TARGET_BYTE(page, column) (OLED_Target->buf[(page) * OLED_Target->w + (column)])
+
+// 异步发送状态
+#define OLED_TX_TIMEOUT 100 // 一帧发送超时时间(ms)
+typedef struct {
+  uint8_t start; // 起始列
+  uint8_t len;   // 列数 为0表示本页不需要发送
+} OLED_Span;
+static OLED_Span OLED_TxSpan[OLED_PAGE]; // 每页需要发送的列范围
+static volatile uint8_t OLED_TxBusy = 0; // 是否有一帧正在发送
+static uint8_t OLED_TxPage;              // 正在发送的页
+static uint8_t OLED_TxStep;              // 当前页的发送步骤 0:页/列地址指令 1:显存数据
+static uint8_t OLED_TxCmd[3];            // 当前页的地址指令
+static uint32_t OLED_TxStartTick;        // 本帧开始发送的时间
+
+// 指令流 多条指令跟在同一个0x00控制字节之后, 一次I2C传输发出
+#define OLED_CMD_STREAM_SIZE 32
+static uint8_t OLED_CmdStream[OLED_CMD_STREAM_SIZE + 1];
+static uint8_t OLED_CmdStreamLen = 0;
+
+// 底层通信接口 由OLED_SetPort()设置
+static const OLED_Port *OLED_PortOps = NULL;
+
+// 每帧实际发送的字节数
+static uint16_t OLED_TxBytes = 0;
+static uint16_t OLED_FrameBytes = 0;
 
 // ========================== 底层通信函数 ==========================
 
+/**
+ * @brief 设置底层通信接口
+ * @param port 接口, STM32上为&OLED_PortSTM32
+ * @note 必须在OLED_Init()之前调用; 移植到其他平台时只需实现一组OLED_Port接口
+ */
+void OLED_SetPort(const OLED_Port *port)
+{
+  OLED_PortOps = port;
+}
+
 /**
  * @brief 向OLED发送数据的函数
- * @param data 要发送的数据
- * @param len 要发送的数据长度
+ * @param data 要发送的数据 data[0]为控制字节
+ * @param len 要发送的数据长度(包含控制字节)
  * @return None
- * @note 此函数是移植本驱动时的重要函数 将本驱动库移植到其他平台时应根据实际情况修改此函数
  */
 void OLED_Send(uint8_t *data, uint8_t len)
 {
-  HAL_I2C_Master_Transmit(&hi2c1, OLED_ADDRESS, data, len, HAL_MAX_DELAY);
+  OLED_WaitFrame(); // 总线上可能还有未发完的一帧
+  if (OLED_PortOps)
+    OLED_PortOps->write(data[0], data + 1, len - 1);
 }
 
 /**
@@ -62,6 +109,41 @@ void OLED_SendCmd(uint8_t cmd)
   OLED_Send(sendBuffer, 2);
 }
 
+/**
+ * @brief 开始一段指令流
+ * @note 用法: OLED_CmdBegin() -> 若干次OLED_CmdPush() -> OLED_CmdFlush()
+ * @note 指令流中的所有指令共用一个控制字节, 只占用一次I2C传输(START/地址/STOP)
+ */
+void OLED_CmdBegin()
+{
+  OLED_CmdStreamLen = 0;
+}
+
+/**
+ * @brief 向指令流追加一条指令 (指令的参数也作为一条指令追加)
+ * @note 缓冲区满时自动发送已缓存的部分
+ */
+void OLED_CmdPush(uint8_t cmd)
+{
+  if (OLED_CmdStreamLen >= OLED_CMD_STREAM_SIZE)
+  {
+    OLED_CmdFlush();
+  }
+  OLED_CmdStream[++OLED_CmdStreamLen] = cmd;
+}
+
+/**
+ * @brief 发送指令流中缓存的指令
+ */
+void OLED_CmdFlush()
+{
+  if (OLED_CmdStreamLen == 0)
+    return;
+  OLED_CmdStream[0] = 0x00; // Co=0 D/C#=0 后面全部是指令
+  OLED_Send(OLED_CmdStream, OLED_CmdStreamLen + 1);
+  OLED_CmdStreamLen = 0;
+}
+
 // ========================== OLED驱动函数 ==========================
 
 /**
@@ -72,44 +154,46 @@ void OLED_Init()
 {
   HAL_Delay(100); // 上电延时，确保屏幕内部复位完成
 
-  OLED_SendCmd(0xAE); // 关闭显示
+  OLED_CmdBegin();
+  OLED_CmdPush(0xAE); // 关闭显示
 
-  OLED_SendCmd(0x02); // 设置低列地址
-  OLED_SendCmd(0x10); // 设置高列地址
-  OLED_SendCmd(0x40); // 设置起始行 (0)
+  OLED_CmdPush(0x02); // 设置低列地址
+  OLED_CmdPush(0x10); // 设置高列地址
+  OLED_CmdPush(0x40); // 设置起始行 (0)
 
-  OLED_SendCmd(0xB0); // 设置页地址
+  OLED_CmdPush(0xB0); // 设置页地址
 
-  OLED_SendCmd(0x81); // 对比度设置
-  OLED_SendCmd(0x80); // 对比度值 (0-255，越大越亮)
+  OLED_CmdPush(0x81); // 对比度设置
+  OLED_CmdPush(0x80); // 对比度值 (0-255，越大越亮)
 
-  OLED_SendCmd(0xA1); // 段重映射 (0xA0/0xA1 翻转左右)
-  OLED_SendCmd(0xC8); // 扫描方向 (0xC0/0xC8 翻转上下)
+  OLED_CmdPush(0xA1); // 段重映射 (0xA0/0xA1 翻转左右)
+  OLED_CmdPush(0xC8); // 扫描方向 (0xC0/0xC8 翻转上下)
 
-  OLED_SendCmd(0xA6); // 正常显示 (0xA7为反色)
+  OLED_CmdPush(0xA6); // 正常显示 (0xA7为反色)
   
-  OLED_SendCmd(0xA8); // 设置复用率
-  OLED_SendCmd(0x3F); // 1/64 Duty
+  OLED_CmdPush(0xA8); // 设置复用率
+  OLED_CmdPush(0x3F); // 1/64 Duty
 
-  OLED_SendCmd(0xAD); // **SH1106特有**: DC-DC 开关模式
-  OLED_SendCmd(0x8B); // 开启内置 DC-DC (如果是外接供电则不同，通常模块都需要开启)
+  OLED_CmdPush(0xAD); // **SH1106特有**: DC-DC 开关模式
+  OLED_CmdPush(0x8B); // 开启内置 DC-DC (如果是外接供电则不同，通常模块都需要开启)
 
-  OLED_SendCmd(0x33); // 设置电荷泵电压 (3.0V~3.3V) (SSD1306是0x8D 0x14)
+  OLED_CmdPush(0x33); // 设置电荷泵电压 (3.0V~3.3V) (SSD1306是0x8D 0x14)
 
-  OLED_SendCmd(0xD3); // 设置显示偏移
-  OLED_SendCmd(0x00);
+  OLED_CmdPush(0xD3); // 设置显示偏移
+  OLED_CmdPush(0x00);
 
-  OLED_SendCmd(0xD5); // 设置分频因子/震荡频率
-  OLED_SendCmd(0x80);
+  OLED_CmdPush(0xD5); // 设置分频因子/震荡频率
+  OLED_CmdPush(0x80);
 
-  OLED_SendCmd(0xD9); // 设置预充电周期
-  OLED_SendCmd(0x1F); // 或者 0x22
+  OLED_CmdPush(0xD9); // 设置预充电周期
+  OLED_CmdPush(0x1F); // 或者 0x22
 
-  OLED_SendCmd(0xDA); // 设置COM硬件引脚配置
-  OLED_SendCmd(0x12);
+  OLED_CmdPush(0xDA); // 设置COM硬件引脚配置
+  OLED_CmdPush(0x12);
 
-  OLED_SendCmd(0xDB); // 设置 VCOMH
-  OLED_SendCmd(0x40);
+  OLED_CmdPush(0xDB); // 设置 VCOMH
+  OLED_CmdPush(0x40);
+  OLED_CmdFlush();
 
   OLED_NewFrame();    // 清显存
   OLED_ShowFrame();   // 刷黑屏
@@ -123,9 +207,11 @@ void OLED_Init()
  */
 void OLED_DisPlay_On()
 {
-  OLED_SendCmd(0x8D); // 电荷泵使能
-  OLED_SendCmd(0x14); // 开启电荷泵
-  OLED_SendCmd(0xAF); // 点亮屏幕
+  OLED_CmdBegin();
+  OLED_CmdPush(0x8D); // 电荷泵使能
+  OLED_CmdPush(0x14); // 开启电荷泵
+  OLED_CmdPush(0xAF); // 点亮屏幕
+  OLED_CmdFlush();
 }
 
 /**
@@ -133,9 +219,11 @@ void OLED_DisPlay_On()
  */
 void OLED_DisPlay_Off()
 {
-  OLED_SendCmd(0x8D); // 电荷泵使能
-  OLED_SendCmd(0x10); // 关闭电荷泵
-  OLED_SendCmd(0xAE); // 关闭屏幕
+  OLED_CmdBegin();
+  OLED_CmdPush(0x8D); // 电荷泵使能
+  OLED_CmdPush(0x10); // 关闭电荷泵
+  OLED_CmdPush(0xAE); // 关闭屏幕
+  OLED_CmdFlush();
 }
 
 /**
@@ -159,6 +247,7 @@ void OLED_SetColorMode(OLED_ColorMode mode)
 
 /**
  * @brief 清空显存 绘制新的一帧
+ * @note 只清空屏幕显存, 与当前绘图目标无关
  */
 void OLED_NewFrame()
 {
@@ -166,23 +255,190 @@ void OLED_NewFrame()
 }
 
 /**
- * @brief 将当前显存显示到屏幕上
+ * @brief 设置绘图目标
+ * @param canvas 画布, 为NULL时恢复为屏幕显存
+ * @note 用于把静态背景预先画到画布上, 之后每帧用OLED_DrawCanvas()贴到屏幕
+ */
+void OLED_SetTarget(Canvas *canvas)
+{
+  OLED_Target = canvas ? canvas : &OLED_Screen;
+}
+
+/**
+ * @brief 清空画布
+ */
+void OLED_ClearCanvas(Canvas *canvas)
+{
+  memset(canvas->buf, 0, canvas->w * ((canvas->h + 7) / 8));
+}
+
+/**
+ * @brief 终止当前的异步发送
+ * @note 屏幕内容未知, 下一帧全屏刷新
+ */
+static void OLED_TxAbort()
+{
+  OLED_ShadowValid = 0;
+  OLED_TxBusy = 0;
+}
+
+/**
+ * @brief 发送异步帧的下一步
+ * @note 每页先用一次传输发送页地址、列地址低4位、列地址高4位三条指令, 再用一次传输发送显存数据
+ * @note 由OLED_ShowFrameAsync()启动, 之后在I2C发送完成中断中调用
+ */
+static void OLED_TxNext()
+{
+  OLED_Span *span;
+  uint8_t column;
+  uint8_t step;
+  uint8_t status;
+
+  if (OLED_TxStep > 1)
+  {
+    OLED_TxPage++;
+    OLED_TxStep = 0;
+  }
+  while (OLED_TxPage < OLED_PAGE && OLED_TxSpan[OLED_TxPage].len == 0)
+  {
+    OLED_TxPage++; // 跳过没有变化的页
+  }
+  if (OLED_TxPage >= OLED_PAGE)
+  {
+    OLED_FrameBytes = OLED_TxBytes;
+    OLED_TxBusy = 0;
+    return;
+  }
+
+  // 先推进状态再发送: 发送完成回调可能在发送函数返回之前就到来
+  span = &OLED_TxSpan[OLED_TxPage];
+  step = OLED_TxStep++;
+  if (step == 0)
+  {
+    column = span->start + OLED_COLUMN_OFFSET;
+    OLED_TxCmd[0] = 0xB0 + OLED_TxPage;      // 设置页地址
+    OLED_TxCmd[1] = column & 0x0F;           // 设置列地址低4位
+    OLED_TxCmd[2] = 0x10 | (column >> 4);    // 设置列地址高4位
+    // 控制字节0x00后面三条指令组成一个指令流
+    OLED_TxBytes += 4;
+    status = OLED_PortOps->writeAsync(0x00, OLED_TxCmd, 3);
+  }
+  else
+  {
+    // 控制字节0x40后面跟显存数据 数据直接取自影子显存(前台缓冲区)
+    OLED_TxBytes += span->len + 1;
+    status = OLED_PortOps->writeAsync(0x40, OLED_ShadowGRAM[OLED_TxPage] + span->start, span->len);
+  }
+  if (status != 0)
+  {
+    OLED_TxAbort();
+  }
+}
+
+/**
+ * @brief 后台发送完成(或出错)
+ * @param ok 1:发送成功 0:出错
+ * @note 由底层通信接口在发送完成中断中调用
+ */
+void OLED_Port_TxDone(uint8_t ok)
+{
+  if (!OLED_TxBusy)
+    return;
+  if (ok)
+    OLED_TxNext();
+  else
+    OLED_TxAbort();
+}
+
+/**
+ * @brief 将当前显存显示到屏幕上 (非阻塞)
  * @note 此函数是移植本驱动时的重要函数 将本驱动库移植到其他驱动芯片时应根据实际情况修改此函数
+ * @note 每页只发送与影子显存不同的那一段列(最左到最右的变化列), 没有变化的页直接跳过
+ * @note 变化的部分先复制到影子显存(前台缓冲区), 再由I2C中断逐页发送, 函数立即返回
+ *       返回后即可调用OLED_NewFrame()绘制下一帧, 上一帧还没发完时会先等待它完成
  */
-void OLED_ShowFrame()
+void OLED_ShowFrameAsync()
 {
-  static uint8_t sendBuffer[OLED_COLUMN + 1];
-  sendBuffer[0] = 0x40;
+  uint8_t start, end;
+
+  OLED_WaitFrame();
+  if (OLED_PortOps == NULL)
+    return;
   for (uint8_t i = 0; i < OLED_PAGE; i++)
   {
-    OLED_SendCmd(0xB0 + i); // 设置页地址
-    OLED_SendCmd(0x02);     // 设置列地址低4位
-    OLED_SendCmd(0x10);     // 设置列地址高4位
-    memcpy(sendBuffer + 1, OLED_GRAM[i], OLED_COLUMN);
-    OLED_Send(sendBuffer, OLED_COLUMN + 1);
+    start = 0;
+    end = OLED_COLUMN - 1;
+    if (OLED_ShadowValid)
+    {
+      // 找出本页变化的列范围
+      while (start < OLED_COLUMN && OLED_GRAM[i][start] == OLED_ShadowGRAM[i][start])
+        start++;
+      if (start == OLED_COLUMN)
+      {
+        OLED_TxSpan[i].len = 0; // 本页没有变化
+        continue;
+      }
+      while (OLED_GRAM[i][end] == OLED_ShadowGRAM[i][end])
+        end--;
+    }
+    OLED_TxSpan[i].start = start;
+    OLED_TxSpan[i].len = end - start + 1;
+    memcpy(OLED_ShadowGRAM[i] + start, OLED_GRAM[i] + start, end - start + 1);
+  }
+  OLED_ShadowValid = 1; // 发送出错时会在OLED_TxAbort()中清零
+
+  OLED_TxBytes = 0;
+  OLED_TxPage = 0;
+  OLED_TxStep = 0;
+  OLED_TxStartTick = HAL_GetTick();
+  OLED_TxBusy = 1;
+  OLED_TxNext();
+}
+
+/**
+ * @brief 将当前显存显示到屏幕上 (阻塞, 发送完成后返回)
+ */
+void OLED_ShowFrame()
+{
+  OLED_ShowFrameAsync();
+  OLED_WaitFrame();
+}
+
+/**
+ * @brief 查询是否有一帧正在发送
+ * @return 1: 正在发送 0: 发送完成/空闲
+ */
+uint8_t OLED_IsFrameBusy()
+{
+  return OLED_TxBusy;
+}
+
+/**
+ * @brief 等待正在发送的一帧完成
+ * @note 超时说明总线卡死, 复位总线后返回, 下一帧全屏刷新
+ */
+void OLED_WaitFrame()
+{
+  while (OLED_TxBusy)
+  {
+    if (HAL_GetTick() - OLED_TxStartTick > OLED_TX_TIMEOUT)
+    {
+      OLED_TxAbort();
+      OLED_PortOps->recover();
+    }
   }
 }
 
+/**
+ * @brief 获取上一帧实际发送的字节数
+ * @return 字节数(包含控制字节和指令), 画面没有变化时为0
+ * @note 全屏刷新约为 8 * (4 + 129) = 1064 字节
+ */
+uint16_t OLED_GetFrameBytes()
+{
+  return OLED_FrameBytes;
+}
+
 /**
  * @brief 设置一个像素点
  * @param x 横坐标
@@ -191,15 +447,15 @@ void OLED_ShowFrame()
  */
 void OLED_SetPixel(uint8_t x, uint8_t y, OLED_ColorMode color)
 {
-  if (x >= OLED_COLUMN || y >= OLED_ROW)
+  if (x >= OLED_Target->w || y >= OLED_Target->h)
     return;
   if (!color)
   {
-    OLED_GRAM[y / 8][x] |= 1 << (y % 8);
+    OLED_TARGET_BYTE(y / 8, x) |= 1 << (y % 8);
   }
   else
   {
-    OLED_GRAM[y / 8][x] &= ~(1 << (y % 8));
+    OLED_TARGET_BYTE(y / 8, x) &= ~(1 << (y % 8));
   }
 }
 
@@ -217,16 +473,16 @@ void OLED_SetPixel(uint8_t x, uint8_t y, OLED_ColorMode color)
  */
 void OLED_SetByte_Fine(uint8_t page, uint8_t column, uint8_t data, uint8_t start, uint8_t end, OLED_ColorMode color)
 {
-  static uint8_t temp;
-  if (page >= OLED_PAGE || column >= OLED_COLUMN)
+  uint8_t temp;
+  if (page >= OLED_TARGET_PAGES || column >= OLED_Target->w)
     return;
   if (color)
     data = ~data;
 
   temp = data | (0xff << (end + 1)) | (0xff >> (8 - start));
-  OLED_GRAM[page][column] &= temp;
+  OLED_TARGET_BYTE(page, column) &= temp;
   temp = data & ~(0xff << (end + 1)) & ~(0xff >> (8 - start));
-  OLED_GRAM[page][column] |= temp;
+  OLED_TARGET_BYTE(page, column) |= temp;
   // 使用OLED_SetPixel实现
   // for (uint8_t i = start; i <= end; i++) {
   //   OLED_SetPixel(column, page * 8 + i, !((data >> i) & 0x01));
@@ -243,11 +499,11 @@ void OLED_SetByte_Fine(uint8_t page, uint8_t column, uint8_t data, uint8_t start
  */
 void OLED_SetByte(uint8_t page, uint8_t column, uint8_t data, OLED_ColorMode color)
 {
-  if (page >= OLED_PAGE || column >= OLED_COLUMN)
+  if (page >= OLED_TARGET_PAGES || column >= OLED_Target->w)
     return;
   if (color)
     data = ~data;
-  OLED_GRAM[page][column] = data;
+  OLED_TARGET_BYTE(page, column) = data;
 }
 
 /**
@@ -300,45 +556,403 @@ void OLED_SetBits(uint8_t x, uint8_t y, uint8_t data, OLED_ColorMode color)
   }
 }
 
+/**
+ * @brief 每页中从第n位到第7位的掩码 (区域的顶部所在页)
+ */
+static const uint8_t OLED_TopMask[8] = {0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80};
+
+/**
+ * @brief 每页中从第0位到第n位的掩码 (区域的底部所在页)
+ */
+static const uint8_t OLED_BottomMask[8] = {0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+
+// 移位 s为正数时左移(向下), 负数时右移(向上)
+#define OLED_SHIFT(v, s) ((s) >= 0 ? (uint8_t)((v) << (s)) : (uint8_t)((v) >> -(s)))
+
+/**
+ * @brief 把一页源数据移位后按光栅运算写入显存的一页
+ * @param page 目标页 (可以超出屏幕, 此时不写入)
+ * @param column 目标起始列
+ * @param src 源数据
+ * @param alpha 源数据的透明掩码 1为不透明, NULL表示全部不透明
+ * @param n 列数
+ * @param shift 移位量 正数左移(向下), 负数右移(向上)
+ * @param mask 源字节中的有效位
+ * @param op 光栅运算
+ * @param inv 源数据先异或的值 (0x00或0xFF, 用于反色)
+ * @note 每列只做一次移位和一次与/或, 对齐、不透明且整字节有效的COPY直接memcpy
+ */
+static void OLED_BlitPage(int16_t page, uint8_t column, const uint8_t *src, const uint8_t *alpha, uint8_t n,
+                          int8_t shift, uint8_t mask, OLED_RasterOp op, uint8_t inv)
+{
+  uint8_t pageMask = OLED_SHIFT(mask, shift);
+  uint8_t *dst;
+  uint8_t b, m;
+
+  if (page < 0 || page >= OLED_TARGET_PAGES || pageMask == 0)
+    return;
+  dst = &OLED_TARGET_BYTE(page, column);
+
+  if (op == OLED_ROP_COPY && shift == 0 && pageMask == 0xFF && !inv && alpha == NULL)
+  {
+    memcpy(dst, src, n); // 页对齐快速路径
+    return;
+  }
+  for (uint8_t i = 0; i < n; i++)
+  {
+    m = pageMask;
+    if (alpha)
+      m &= OLED_SHIFT(alpha[i], shift);
+    b = OLED_SHIFT(src[i] ^ inv, shift) & m;
+    switch (op)
+    {
+    case OLED_ROP_COPY:
+      dst[i] = (dst[i] & ~m) | b;
+      break;
+    case OLED_ROP_OR:
+      dst[i] |= b;
+      break;
+    case OLED_ROP_CLEAR:
+      dst[i] &= ~b;
+      break;
+    case OLED_ROP_XOR:
+      dst[i] ^= b;
+      break;
+    }
+  }
+}
+
+/**
+ * @brief 按光栅运算把一块数据写入显存
+ * @param x 起始横坐标 (可以为负数)
+ * @param y 起始纵坐标 (可以为负数)
+ * @param data 数据的起始地址
+ * @param alpha 透明掩码 与data排列相同, 1为不透明, NULL表示全部不透明
+ * @param w 宽度
+ * @param h 高度
+ * @param op 光栅运算
+ * @param inv 源数据先异或的值 (0x00或0xFF)
+ * @note 超出屏幕的部分被裁掉; 源数据的每一页最多写入两个目标页
+ */
+static void OLED_Blit(int16_t x, int16_t y, const uint8_t *data, const uint8_t *alpha, uint8_t w, uint8_t h,
+                      OLED_RasterOp op, uint8_t inv)
+{
+  uint8_t srcPages = (h + 7) / 8;
+  int16_t colStart = 0; // 源数据中需要绘制的列范围 [colStart, colEnd)
+  int16_t colEnd = w;
+  int16_t top, page;
+  uint16_t offset;
+  uint8_t bit, mask;
+
+  // 裁剪 只在开始时计算一次
+  if (x < 0)
+    colStart = -x;
+  if (x + w > OLED_Target->w)
+    colEnd = OLED_Target->w - x;
+  if (colStart >= colEnd || y >= OLED_Target->h || y + h <= 0)
+    return;
+
+  for (uint8_t sp = 0; sp < srcPages; sp++)
+  {
+    top = y + sp * 8;          // 这一页源数据第0位所在的纵坐标
+    page = (top >= 0) ? top / 8 : -((7 - top) / 8); // 向下取整 (top可能为负数)
+    bit = top - page * 8;
+    mask = 0xFF;
+    if (sp == srcPages - 1 && (h % 8))
+      mask = OLED_BottomMask[h % 8 - 1]; // 最后一页只有低h%8位有效
+
+    offset = sp * w + colStart;
+    OLED_BlitPage(page, x + colStart, data + offset, alpha ? alpha + offset : NULL, colEnd - colStart, bit, mask, op, inv);
+    if (bit)
+      OLED_BlitPage(page + 1, x + colStart, data + offset, alpha ? alpha + offset : NULL, colEnd - colStart, bit - 8, mask, op, inv);
+  }
+}
+
+/**
+ * @brief 按光栅运算把一个压缩字模写入显存
+ * @param x 起始横坐标 (可以为负数)
+ * @param y 起始纵坐标 (可以为负数)
+ * @param packed 压缩字模: 非零字节掩码 ((页数 * w + 7) / 8 字节) + 非零字节, 字节顺序与未压缩的字模相同
+ * @param w 宽度
+ * @param h 高度
+ * @param op 光栅运算
+ * @param inv 源数据先异或的值 (0x00或0xFF)
+ * @note 边解码边写入: 每个源字节移位后直接写入它覆盖的一到两个目标页, 不需要先解压到缓冲区
+ * @note OR/CLEAR/XOR时0字节(约占字模的1/3)直接跳过
+ */
+static void OLED_BlitPacked(int16_t x, int16_t y, const uint8_t *packed, uint8_t w, uint8_t h, OLED_RasterOp op,
+                            uint8_t inv)
+{
+  uint8_t srcPages = (h + 7) / 8;
+  const uint8_t *mask = packed;
+  const uint8_t *data = packed + (srcPages * w + 7) / 8;
+  uint16_t i = 0;
+  int16_t top, page;
+  int16_t colStart = 0, colEnd = w; // 需要绘制的列范围 [colStart, colEnd)
+  uint8_t bit, srcMask, bits = 0, v;
+  uint8_t m[2];
+  uint8_t *dst[2];
+
+  if (x < 0)
+    colStart = -x;
+  if (x + w > OLED_Target->w)
+    colEnd = OLED_Target->w - x;
+  if (colStart >= colEnd || y >= OLED_Target->h || y + h <= 0)
+    return;
+
+  for (uint8_t sp = 0; sp < srcPages; sp++)
+  {
+    top = y + sp * 8;
+    page = (top >= 0) ? top / 8 : -((7 - top) / 8); // 向下取整 (top可能为负数)
+    bit = top - page * 8;
+    srcMask = 0xFF;
+    if (sp == srcPages - 1 && (h % 8))
+      srcMask = OLED_BottomMask[h % 8 - 1];
+
+    // 源字节覆盖的两个目标页 不在屏幕内的页掩码为0
+    m[0] = srcMask << bit;
+    m[1] = bit ? srcMask >> (8 - bit) : 0;
+    if (page < 0 || page >= OLED_TARGET_PAGES)
+      m[0] = 0;
+    if (page + 1 < 0 || page + 1 >= OLED_TARGET_PAGES)
+      m[1] = 0;
+    dst[0] = m[0] ? &OLED_TARGET_BYTE(page, x) : NULL;
+    dst[1] = m[1] ? &OLED_TARGET_BYTE(page + 1, x) : NULL;
+
+    for (int16_t c = 0; c < w; c++, i++)
+    {
+      if ((i & 7) == 0)
+        bits = *mask++;
+      v = (bits & 1) ? *data++ : 0;
+      bits >>= 1;
+
+      v ^= inv;
+      if ((v == 0 && op != OLED_ROP_COPY) || c < colStart || c >= colEnd)
+        continue;
+
+      for (uint8_t k = 0; k < 2; k++)
+      {
+        uint8_t b, *d;
+        if (dst[k] == NULL)
+          continue;
+        d = dst[k] + c;
+        b = (k ? v >> (8 - bit) : v << bit) & m[k];
+        switch (op)
+        {
+        case OLED_ROP_COPY:
+          *d = (*d & ~m[k]) | b;
+          break;
+        case OLED_ROP_OR:
+          *d |= b;
+          break;
+        case OLED_ROP_CLEAR:
+          *d &= ~b;
+          break;
+        case OLED_ROP_XOR:
+          *d ^= b;
+          break;
+        }
+      }
+    }
+  }
+}
+
 /**
  * @brief 设置一块显存区域
- * @param x 起始横坐标
- * @param y 起始纵坐标
+ * @param x 起始横坐标 (可以为负数)
+ * @param y 起始纵坐标 (可以为负数)
  * @param data 数据的起始地址
  * @param w 宽度
  * @param h 高度
  * @param color 颜色
- * @note 此函数将显存中从(x,y)开始的w*h个像素设置为data中的数据
+ * @note 此函数将显存中从(x,y)开始的w*h个像素设置为data中的数据, 超出屏幕的部分被裁掉
  * @note data的数据应该采用列行式排列
+ * @note y为8的倍数时每页直接复制
+ */
+void OLED_SetBlock(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, OLED_ColorMode color)
+{
+  OLED_Blit(x, y, data, NULL, w, h, OLED_ROP_COPY, color ? 0xFF : 0x00);
+}
+
+/**
+ * @brief 把一块画布贴到当前绘图目标上
+ * @param x 起始横坐标 (可以为负数)
+ * @param y 起始纵坐标 (可以为负数)
+ * @param canvas 源画布, 不能是当前绘图目标本身
+ * @param op 光栅运算 预渲染的背景通常用OLED_ROP_COPY, 叠加的前景用OLED_ROP_OR
+ * @note y为8的倍数时用OLED_ROP_COPY贴图, 每页就是一次memcpy
+ */
+void OLED_DrawCanvas(int16_t x, int16_t y, const Canvas *canvas, OLED_RasterOp op)
+{
+  OLED_Blit(x, y, canvas->buf, NULL, canvas->w, canvas->h, op, 0x00);
+}
+
+/**
+ * @brief 8x8位矩阵转置
+ * @param in 输入 in[r]的第c位为矩阵第r行第c列
+ * @param out 输出 out[c]的第7-r位为矩阵第r行第c列 (转置的同时翻转位序, 恰好对应旋转90度)
+ * @note 分成两个32位字做三轮交换 (Hacker's Delight 7-3), 不需要逐位处理
  */
-void OLED_SetBlock(uint8_t x, uint8_t y, const uint8_t *data, uint8_t w, uint8_t h, OLED_ColorMode color)
+static void OLED_Transpose8(const uint8_t *in, uint8_t *out)
 {
-  uint8_t fullRow = h / 8; // 完整的行数
-  uint8_t partBit = h % 8; // 不完整的字节中的有效位数
-  for (uint8_t i = 0; i < w; i++)
+  uint32_t x, y, t;
+
+  x = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 8) | in[3];
+  y = ((uint32_t)in[4] << 24) | ((uint32_t)in[5] << 16) | ((uint32_t)in[6] << 8) | in[7];
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  out[7] = x >> 24;
+  out[6] = x >> 16;
+  out[5] = x >> 8;
+  out[4] = x;
+  out[3] = y >> 24;
+  out[2] = y >> 16;
+  out[1] = y >> 8;
+  out[0] = y;
+}
+
+/**
+ * @brief 把一块数据旋转90度后按光栅运算写入显存
+ * @param x 目标左上角横坐标 (可以为负数)
+ * @param y 目标左上角纵坐标 (可以为负数)
+ * @param data 数据 与OLED_SetBlock相同按页排列, 宽w高h
+ * @param w 数据宽度 (旋转后为高度)
+ * @param h 数据高度 (旋转后为宽度)
+ * @param op 光栅运算
+ * @note 数据第c列第r行画在目标的(x + r, y + w - 1 - c): 竖着拿设备时看到的是正的
+ * @note 按8x8的块处理: 数据的一块(8列x1页)转置后正好是目标的一块(8列x1页), 再用OLED_Blit写入,
+ *       不需要逐个像素判断和写入
+ */
+void OLED_SetBlockRotated(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, OLED_RasterOp op)
+{
+  uint8_t in[8], tile[8], alpha[8];
+  uint8_t rows, cols, m;
+
+  for (uint8_t p = 0; p < (h + 7) / 8; p++)
   {
-    for (uint8_t j = 0; j < fullRow; j++)
+    cols = (h - p * 8 < 8) ? h - p * 8 : 8; // 这一页的行数 = 旋转后的列数
+    for (uint8_t c0 = 0; c0 < w; c0 += 8)
     {
-      OLED_SetBits(x + i, y + j * 8, data[i + j * w], color);
+      rows = (w - c0 < 8) ? w - c0 : 8; // 这一块的列数 = 旋转后的行数
+      for (uint8_t i = 0; i < 8; i++)
+        in[i] = (i < rows) ? data[p * w + c0 + i] : 0;
+      OLED_Transpose8(in, tile);
+      // 旋转后块的第7-i行来自第c0+i列, 不足8列时上面几行没有数据;
+      // 补的0位对OR/CLEAR/XOR没有影响, 只有COPY需要用掩码保持显存不变
+      if (op == OLED_ROP_COPY && rows < 8)
+      {
+        m = 0xFF << (8 - rows);
+        for (uint8_t j = 0; j < cols; j++)
+          alpha[j] = m;
+        OLED_Blit(x + p * 8, y + w - c0 - 8, tile, alpha, cols, 8, op, 0x00);
+      }
+      else
+        OLED_Blit(x + p * 8, y + w - c0 - 8, tile, NULL, cols, 8, op, 0x00);
     }
   }
-  if (partBit)
+}
+
+/**
+ * @brief 按光栅运算把一块数据写入显存
+ * @param op OLED_ROP_COPY覆盖 OLED_ROP_OR叠加 OLED_ROP_CLEAR擦除 OLED_ROP_XOR取反
+ * @note 其余参数同OLED_SetBlock; 对OR/CLEAR/XOR, data中为0的位不改变显存
+ */
+void OLED_SetBlockOp(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, OLED_RasterOp op)
+{
+  OLED_Blit(x, y, data, NULL, w, h, op, 0x00);
+}
+
+/**
+ * @brief 按光栅运算处理一块矩形区域
+ * @param x 起始横坐标
+ * @param y 起始纵坐标
+ * @param w 宽度(列数)
+ * @param h 高度(行数)
+ * @param op OLED_ROP_COPY/OLED_ROP_OR点亮 OLED_ROP_CLEAR熄灭 OLED_ROP_XOR取反
+ * @note 区域超出屏幕的部分会被裁掉
+ * @note 按页处理: 每页先算出一个掩码, 再对w列做同一个字节运算, 整个区域最多 w * 页数 次字节操作
+ */
+void OLED_FillAreaOp(int16_t x, int16_t y, int16_t w, int16_t h, OLED_RasterOp op)
+{
+  int16_t x2 = x + w; // 不包含
+  int16_t y2 = y + h; // 不包含
+  uint8_t pageStart, pageEnd, mask;
+  uint8_t *row;
+
+  if (x < 0)
+    x = 0;
+  if (y < 0)
+    y = 0;
+  if (x2 > OLED_Target->w)
+    x2 = OLED_Target->w;
+  if (y2 > OLED_Target->h)
+    y2 = OLED_Target->h;
+  if (x >= x2 || y >= y2)
+    return;
+
+  pageStart = y / 8;
+  pageEnd = (y2 - 1) / 8;
+  for (uint8_t page = pageStart; page <= pageEnd; page++)
   {
-    uint16_t fullNum = w * fullRow; // 完整的字节数
-    for (uint8_t i = 0; i < w; i++)
+    mask = 0xFF;
+    if (page == pageStart)
+      mask &= OLED_TopMask[y % 8];
+    if (page == pageEnd)
+      mask &= OLED_BottomMask[(y2 - 1) % 8];
+
+    row = &OLED_TARGET_BYTE(page, x);
+    if (op == OLED_ROP_XOR)
+    {
+      for (int16_t i = x; i < x2; i++)
+        *row++ ^= mask;
+    }
+    else if (op == OLED_ROP_CLEAR)
+    {
+      mask = ~mask;
+      for (int16_t i = x; i < x2; i++)
+        *row++ &= mask;
+    }
+    else
     {
-      OLED_SetBits_Fine(x + i, y + (fullRow * 8), data[fullNum + i], partBit, color);
+      for (int16_t i = x; i < x2; i++)
+        *row++ |= mask;
     }
   }
-  // 使用OLED_SetPixel实现
-  // for (uint8_t i = 0; i < w; i++) {
-  //   for (uint8_t j = 0; j < h; j++) {
-  //     for (uint8_t k = 0; k < 8; k++) {
-  //       if (j * 8 + k >= h) break; // 防止越界(不完整的字节
-  //       OLED_SetPixel(x + i, y + j * 8 + k, !((data[i + j * w] >> k) & 0x01));
-  //     }
-  //   }
-  // }
+}
+
+/**
+ * @brief 填充一块矩形区域
+ * @param x 起始横坐标
+ * @param y 起始纵坐标
+ * @param w 宽度(列数)
+ * @param h 高度(行数)
+ * @param color 颜色
+ */
+void OLED_FillArea(int16_t x, int16_t y, int16_t w, int16_t h, OLED_ColorMode color)
+{
+  OLED_FillAreaOp(x, y, w, h, color ? OLED_ROP_CLEAR : OLED_ROP_OR);
+}
+
+/**
+ * @brief 反色一块矩形区域
+ * @note 用于选中高亮: 先正常绘制文字, 再把整行反色, 不需要先填充再反色重绘
+ */
+void OLED_InvertArea(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  OLED_FillAreaOp(x, y, w, h, OLED_ROP_XOR);
 }
 
 // ========================== 图形绘制函数 ==========================
@@ -362,10 +976,7 @@ void OLED_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, OLED_ColorMod
       y1 = y2;
       y2 = temp;
     }
-    for (uint8_t y = y1; y <= y2; y++)
-    {
-      OLED_SetPixel(x1, y, color);
-    }
+    OLED_FillArea(x1, y1, 1, y2 - y1 + 1, color); // 竖线: 每页一个字节
   }
   else if (y1 == y2)
   {
@@ -375,10 +986,7 @@ void OLED_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, OLED_ColorMod
       x1 = x2;
       x2 = temp;
     }
-    for (uint8_t x = x1; x <= x2; x++)
-    {
-      OLED_SetPixel(x, y1, color);
-    }
+    OLED_FillArea(x1, y1, x2 - x1 + 1, 1, color); // 横线: 同一页内连续的字节
   }
   else
   {
@@ -429,10 +1037,10 @@ void OLED_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, OLED_ColorMod
  */
 void OLED_DrawRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, OLED_ColorMode color)
 {
-  OLED_DrawLine(x, y, x + w, y, color);
-  OLED_DrawLine(x, y + h, x + w, y + h, color);
-  OLED_DrawLine(x, y, x, y + h, color);
-  OLED_DrawLine(x + w, y, x + w, y + h, color);
+  OLED_FillArea(x, y, w + 1, 1, color);
+  OLED_FillArea(x, y + h, w + 1, 1, color);
+  OLED_FillArea(x, y, 1, h + 1, color);
+  OLED_FillArea(x + w, y, 1, h + 1, color);
 }
 
 /**
@@ -442,13 +1050,11 @@ void OLED_DrawRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, OLED_ColorMo
  * @param w 矩形宽度
  * @param h 矩形高度
  * @param color 颜色
+ * @note 覆盖第x到第x+w列(共w+1列)、第y到第y+h-1行, 与原先逐行画线的结果一致
  */
 void OLED_DrawFilledRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, OLED_ColorMode color)
 {
-  for (uint8_t i = 0; i < h; i++)
-  {
-    OLED_DrawLine(x, y + i, x + w, y + i, color);
-  }
+  OLED_FillArea(x, y, w + 1, h, color);
 }
 
 /**
@@ -468,6 +1074,78 @@ void OLED_DrawTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t x
   OLED_DrawLine(x3, y3, x1, y1, color);
 }
 
+/**
+ * @brief 绘制一段竖线 (内部使用)
+ * @param x 横坐标
+ * @param y1 起点纵坐标
+ * @param y2 终点纵坐标 (可以小于y1)
+ * @param color 颜色
+ */
+static void OLED_VSpan(int16_t x, int16_t y1, int16_t y2, OLED_ColorMode color)
+{
+  if (y1 > y2)
+    OLED_FillArea(x, y2, 1, y1 - y2 + 1, color);
+  else
+    OLED_FillArea(x, y1, 1, y2 - y1 + 1, color);
+}
+
+/**
+ * @brief 三角形的一条边 (内部使用)
+ */
+typedef struct OLED_Edge {
+  int16_t x, y;   // 起点
+  int16_t dx, dy; // 横纵方向的长度 (绝对值)
+  int8_t ux, uy;  // 横纵方向的步进 (+1或-1)
+} OLED_Edge;
+
+static void OLED_EdgeInit(OLED_Edge *e, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  e->x = x1;
+  e->y = y1;
+  e->dx = abs(x2 - x1);
+  e->dy = abs(y2 - y1);
+  e->ux = (x2 > x1) ? 1 : -1;
+  e->uy = (y2 > y1) ? 1 : -1;
+}
+
+/**
+ * @brief 求边在第x列上的点, 把纵坐标范围并入[*lo, *hi] (内部使用)
+ * @note 与OLED_DrawLine从起点画到终点的Bresenham结果相同 (另外包含终点):
+ *       横向为主时第k列 n = floor((2k*dy + dx) / (2dx)), 即四舍五入(0.5进位);
+ *       纵向为主时第j列包含 n(m) = j 的所有行 m, 由 n(m) >= j 反推出最小的 m
+ */
+static void OLED_EdgeSpan(const OLED_Edge *e, int16_t x, int16_t *lo, int16_t *hi)
+{
+  int32_t k = (x - e->x) * e->ux; // 从起点开始的第几列
+  int32_t m1, m2;
+  int16_t y1, y2;
+
+  if (k < 0 || k > e->dx)
+    return;
+  if (e->dx == 0) // 竖线
+  {
+    m1 = 0;
+    m2 = e->dy;
+  }
+  else if (e->dx > e->dy) // 横向为主: 每列一个点
+  {
+    m1 = m2 = (2 * k * e->dy + e->dx) / (2 * e->dx);
+  }
+  else // 纵向为主: 每列一段
+  {
+    m1 = (k == 0) ? 0 : ((2 * k - 1) * e->dy + 2 * e->dx - 1) / (2 * e->dx);
+    m2 = (k == e->dx) ? e->dy : ((2 * k + 1) * e->dy + 2 * e->dx - 1) / (2 * e->dx) - 1;
+  }
+  y1 = e->y + e->uy * m1;
+  y2 = e->y + e->uy * m2;
+  if (y1 > y2)
+    k = y1, y1 = y2, y2 = k;
+  if (y1 < *lo)
+    *lo = y1;
+  if (y2 > *hi)
+    *hi = y2;
+}
+
 /**
  * @brief 绘制一个填充三角形
  * @param x1 第一个点横坐标
@@ -477,36 +1155,36 @@ void OLED_DrawTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t x
  * @param x3 第三个点横坐标
  * @param y3 第三个点纵坐标
  * @param color 颜色
+ * @note 按列扫描: 每列从三条边在这一列上最上面的点画到最下面的点(一段竖线, 每页一个字节)
+ * @note 边上的点与OLED_DrawTriangle画出的完全相同, 所以填充三角形总是盖住它的边框
  */
 void OLED_DrawFilledTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t x3, uint8_t y3, OLED_ColorMode color)
 {
-  uint8_t a = 0, b = 0, y = 0, last = 0;
-  if (y1 > y2)
-  {
-    a = y2;
-    b = y1;
-  }
-  else
-  {
-    a = y1;
-    b = y2;
-  }
-  y = a;
-  for (; y <= b; y++)
-  {
-    if (y <= y3)
-    {
-      OLED_DrawLine(x1 + (y - y1) * (x2 - x1) / (y2 - y1), y, x1 + (y - y1) * (x3 - x1) / (y3 - y1), y, color);
-    }
-    else
-    {
-      last = y - 1;
-      break;
-    }
-  }
-  for (; y <= b; y++)
+  OLED_Edge e[3];
+  int16_t xMin = x1, xMax = x1, lo, hi;
+
+  // 方向与OLED_DrawTriangle相同: 1->2, 2->3, 3->1
+  OLED_EdgeInit(&e[0], x1, y1, x2, y2);
+  OLED_EdgeInit(&e[1], x2, y2, x3, y3);
+  OLED_EdgeInit(&e[2], x3, y3, x1, y1);
+  if (x2 < xMin)
+    xMin = x2;
+  if (x3 < xMin)
+    xMin = x3;
+  if (x2 > xMax)
+    xMax = x2;
+  if (x3 > xMax)
+    xMax = x3;
+  if (xMax >= OLED_Target->w)
+    xMax = OLED_Target->w - 1;
+
+  for (int16_t x = xMin; x <= xMax; x++)
   {
-    OLED_DrawLine(x2 + (y - y2) * (x3 - x2) / (y3 - y2), y, x1 + (y - last) * (x3 - x1) / (y3 - last), y, color);
+    lo = 0x7FFF;
+    hi = -1;
+    for (uint8_t i = 0; i < 3; i++)
+      OLED_EdgeSpan(&e[i], x, &lo, &hi);
+    OLED_VSpan(x, lo, hi, color);
   }
 }
 
@@ -552,23 +1230,22 @@ void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r, OLED_ColorMode color)
  * @param y 圆心纵坐标
  * @param r 圆半径
  * @param color 颜色
- * @note 此函数使用Bresenham算法绘制圆
+ * @note 此函数使用Bresenham算法绘制圆, 形状与OLED_DrawCircle一致
+ * @note 每一列只画一次竖线(每页一个字节), 没有重复绘制
  */
 void OLED_DrawFilledCircle(uint8_t x, uint8_t y, uint8_t r, OLED_ColorMode color)
 {
   int16_t a = 0, b = r, di = 3 - (r << 1);
+  int16_t lastA, lastB;
   while (a <= b)
   {
-    for (int16_t i = x - b; i <= x + b; i++)
-    {
-      OLED_SetPixel(i, y + a, color);
-      OLED_SetPixel(i, y - a, color);
-    }
-    for (int16_t i = x - a; i <= x + a; i++)
-    {
-      OLED_SetPixel(i, y + b, color);
-      OLED_SetPixel(i, y - b, color);
-    }
+    // 第a列 半高为b (a每次加1, 每列只出现一次)
+    OLED_VSpan(x + a, y - b, y + b, color);
+    if (a)
+      OLED_VSpan(x - a, y - b, y + b, color);
+
+    lastA = a;
+    lastB = b;
     a++;
     if (di < 0)
     {
@@ -579,56 +1256,122 @@ void OLED_DrawFilledCircle(uint8_t x, uint8_t y, uint8_t r, OLED_ColorMode color
       di += 10 + 4 * (a - b);
       b--;
     }
+
+    // 第b列 半高为a: b即将改变(或循环结束)时a最大, 此时画一次
+    if ((b != lastB || a > b) && lastB != lastA)
+    {
+      OLED_VSpan(x + lastB, y - lastA, y + lastA, color);
+      OLED_VSpan(x - lastB, y - lastA, y + lastA, color);
+    }
   }
 }
 
 /**
- * @brief 绘制一个椭圆
- * @param x 椭圆中心横坐标
- * @param y 椭圆中心纵坐标
- * @param a 椭圆长轴
- * @param b 椭圆短轴
+ * @brief 画椭圆第一象限上的一个点及其对称点 (内部使用)
+ * @param filled 为0时画四个对称点, 为1时画两条竖线
  */
-void OLED_DrawEllipse(uint8_t x, uint8_t y, uint8_t a, uint8_t b, OLED_ColorMode color)
+static void OLED_EllipsePlot(uint8_t x, uint8_t y, int16_t xpos, int16_t ypos, uint8_t filled, OLED_ColorMode color)
 {
-  int xpos = 0, ypos = b;
-  int a2 = a * a, b2 = b * b;
-  int d = b2 + a2 * (0.25 - b);
-  while (a2 * ypos > b2 * xpos)
+  if (filled)
+  {
+    OLED_VSpan(x + xpos, y - ypos, y + ypos, color);
+    if (xpos)
+      OLED_VSpan(x - xpos, y - ypos, y + ypos, color);
+  }
+  else
   {
     OLED_SetPixel(x + xpos, y + ypos, color);
     OLED_SetPixel(x - xpos, y + ypos, color);
     OLED_SetPixel(x + xpos, y - ypos, color);
     OLED_SetPixel(x - xpos, y - ypos, color);
+  }
+}
+
+/**
+ * @brief 遍历椭圆第一象限上的点 (内部使用)
+ * @param x 椭圆中心横坐标
+ * @param y 椭圆中心纵坐标
+ * @param a 椭圆横向半轴
+ * @param b 椭圆纵向半轴
+ * @param filled 为0时画空心椭圆, 为1时每列画一条竖线(填充)
+ * @param color 颜色
+ * @note 中点算法, 判别式整体乘4以去掉0.25和0.5, 只用整数运算
+ */
+static void OLED_EllipseCore(uint8_t x, uint8_t y, uint8_t a, uint8_t b, uint8_t filled, OLED_ColorMode color)
+{
+  int32_t xpos = 0, ypos = b;
+  int32_t a2 = (int32_t)a * a, b2 = (int32_t)b * b;
+  int32_t d = 4 * b2 + a2 * (1 - 4 * (int32_t)b); // 4 * (b2 + a2 * (0.25 - b))
+  int32_t lastX = -1;
+
+  // 区域1: 斜率绝对值小于1, 每步横坐标加1, 每列只有一个点
+  while (a2 * ypos > b2 * xpos)
+  {
+    OLED_EllipsePlot(x, y, xpos, ypos, filled, color);
     if (d < 0)
     {
-      d = d + b2 * ((xpos << 1) + 3);
+      d += 4 * b2 * ((xpos << 1) + 3);
       xpos += 1;
     }
     else
     {
-      d = d + b2 * ((xpos << 1) + 3) + a2 * (-(ypos << 1) + 2);
+      d += 4 * (b2 * ((xpos << 1) + 3) + a2 * (-(ypos << 1) + 2));
       xpos += 1, ypos -= 1;
     }
   }
-  d = b2 * (xpos + 0.5) * (xpos + 0.5) + a2 * (ypos - 1) * (ypos - 1) - a2 * b2;
+
+  // 区域2: 每步纵坐标减1, 同一列可能有多个点
+  // 4 * (b2 * (xpos + 0.5)^2 + a2 * (ypos - 1)^2 - a2 * b2)
+  d = b2 * ((xpos << 1) + 1) * ((xpos << 1) + 1) + 4 * (a2 * (ypos - 1) * (ypos - 1) - a2 * b2);
   while (ypos > 0)
   {
-    OLED_SetPixel(x + xpos, y + ypos, color);
-    OLED_SetPixel(x - xpos, y + ypos, color);
-    OLED_SetPixel(x + xpos, y - ypos, color);
-    OLED_SetPixel(x - xpos, y - ypos, color);
+    // 填充时同一列只画第一个点(纵坐标最大), 之后的点已被这条竖线覆盖
+    if (!filled || xpos != lastX)
+      OLED_EllipsePlot(x, y, xpos, ypos, filled, color);
+    lastX = xpos;
     if (d < 0)
     {
-      d = d + b2 * ((xpos << 1) + 2) + a2 * (-(ypos << 1) + 3);
+      d += 4 * (b2 * ((xpos << 1) + 2) + a2 * (-(ypos << 1) + 3));
       xpos += 1, ypos -= 1;
     }
     else
     {
-      d = d + a2 * (-(ypos << 1) + 3);
+      d += 4 * a2 * (-(ypos << 1) + 3);
       ypos -= 1;
     }
   }
+
+  // 最后一行一直画到横轴端点 (很扁的椭圆中点算法到不了端点)
+  for (; xpos <= a; xpos++)
+  {
+    if (!filled || xpos != lastX)
+      OLED_EllipsePlot(x, y, xpos, 0, filled, color);
+  }
+}
+
+/**
+ * @brief 绘制一个椭圆
+ * @param x 椭圆中心横坐标
+ * @param y 椭圆中心纵坐标
+ * @param a 椭圆长轴
+ * @param b 椭圆短轴
+ */
+void OLED_DrawEllipse(uint8_t x, uint8_t y, uint8_t a, uint8_t b, OLED_ColorMode color)
+{
+  OLED_EllipseCore(x, y, a, b, 0, color);
+}
+
+/**
+ * @brief 绘制一个填充椭圆
+ * @param x 椭圆中心横坐标
+ * @param y 椭圆中心纵坐标
+ * @param a 椭圆横向半轴
+ * @param b 椭圆纵向半轴
+ * @note 与OLED_DrawEllipse形状一致, 每一列只画一次竖线
+ */
+void OLED_DrawFilledEllipse(uint8_t x, uint8_t y, uint8_t a, uint8_t b, OLED_ColorMode color)
+{
+  OLED_EllipseCore(x, y, a, b, 1, color);
 }
 
 /**
@@ -638,13 +1381,74 @@ void OLED_DrawEllipse(uint8_t x, uint8_t y, uint8_t a, uint8_t b, OLED_ColorMode
  * @param img 图片
  * @param color 颜色
  */
-void OLED_DrawImage(uint8_t x, uint8_t y, const Image *img, OLED_ColorMode color)
+void OLED_DrawImage(int16_t x, int16_t y, const Image *img, OLED_ColorMode color)
+{
+  OLED_Blit(x, y, img->data, img->mask, img->w, img->h, OLED_ROP_COPY, color ? 0xFF : 0x00);
+}
+
+/**
+ * @brief 按光栅运算绘制一张图片
+ * @param x 起始点横坐标
+ * @param y 起始点纵坐标
+ * @param img 图片
+ * @param op 光栅运算 例如OLED_ROP_OR叠加到背景上而不擦除背景
+ */
+void OLED_DrawImageOp(int16_t x, int16_t y, const Image *img, OLED_RasterOp op)
 {
-  OLED_SetBlock(x, y, img->data, img->w, img->h, color);
+  OLED_Blit(x, y, img->data, img->mask, img->w, img->h, op, 0x00);
 }
 
 // ================================ 文字绘制 ================================
 
+/**
+ * @brief 取压缩的等宽字体中一个字的字模
+ * @note 从索引记录的位置(每ASCII_PACK_INDEX_STEP个字一个)开始, 按掩码中1的个数跳过前面的字
+ */
+static const uint8_t *OLED_GetPackedGlyph(const ASCIIFont *font, char ch)
+{
+  uint8_t index = (ch >= ' ' && ch <= '~') ? ch - ' ' : 0;
+  uint8_t maskBytes = (((font->h + 7) / 8) * font->w + 7) / 8;
+  const uint8_t *p = font->chars + font->index[index / ASCII_PACK_INDEX_STEP];
+  uint8_t n, b;
+
+  for (uint8_t k = index - index % ASCII_PACK_INDEX_STEP; k < index; k++)
+  {
+    n = maskBytes;
+    for (uint8_t j = 0; j < maskBytes; j++)
+    {
+      for (b = p[j]; b; b &= b - 1) // 数1的个数
+        n++;
+    }
+    p += n;
+  }
+  return p;
+}
+
+/**
+ * @brief 叠加一个字模 (比例字体或压缩字体, 背景由调用者填充)
+ * @param ch 字符 必须在' '到'~'之间
+ */
+static void OLED_DrawGlyph(int16_t x, int16_t y, const ASCIIFont *font, char ch, OLED_ColorMode color)
+{
+  OLED_RasterOp op = color ? OLED_ROP_CLEAR : OLED_ROP_OR;
+  const ASCIIGlyph *glyph;
+
+  if (font->glyphs == NULL) // 压缩的等宽字体
+  {
+    OLED_BlitPacked(x, y, OLED_GetPackedGlyph(font, ch), font->w, font->h, op, 0x00);
+    return;
+  }
+
+  glyph = &font->glyphs[ch - ' '];
+  if (glyph->w == 0)
+    return;
+  x += glyph->bearing >> 4;
+  if (font->packed)
+    OLED_BlitPacked(x, y, font->chars + glyph->offset, glyph->w, font->h, op, 0x00);
+  else
+    OLED_SetBlockOp(x, y, font->chars + glyph->offset, glyph->w, font->h, op);
+}
+
 /**
  * @brief 绘制一个ASCII字符
  * @param x 起始点横坐标
@@ -653,9 +1457,61 @@ void OLED_DrawImage(uint8_t x, uint8_t y, const Image *img, OLED_ColorMode color
  * @param font 字体
  * @param color 颜色
  */
-void OLED_PrintASCIIChar(uint8_t x, uint8_t y, char ch, const ASCIIFont *font, OLED_ColorMode color)
+void OLED_PrintASCIIChar(int16_t x, int16_t y, char ch, const ASCIIFont *font, OLED_ColorMode color)
+{
+  if (font->glyphs == NULL && !font->packed)
+  {
+    OLED_SetBlock(x, y, font->chars + (ch - ' ') * (((font->h + 7) / 8) * font->w), font->w, font->h, color);
+    return;
+  }
+
+  // 比例字体或压缩字体: 先填充整个字符(含留白)的背景, 再叠加字模
+  if (ch < ' ' || ch > '~')
+    return;
+  OLED_FillAreaOp(x, y, OLED_GetASCIIAdvance(font, ch, 0), font->h, color ? OLED_ROP_OR : OLED_ROP_CLEAR);
+  OLED_DrawGlyph(x, y, font, ch, color);
+}
+
+/**
+ * @brief 获取ASCII字符的前进量(绘制后光标移动的距离)
+ * @param font 字体
+ * @param ch 字符
+ * @param next 后一个字符 用于字距调整, 不需要时为0
+ * @return 前进量 等宽字体为font->w
+ * @note 字距调整表按(left, right)升序排列, 二分查找
+ */
+int16_t OLED_GetASCIIAdvance(const ASCIIFont *font, char ch, char next)
 {
-  OLED_SetBlock(x, y, font->chars + (ch - ' ') * (((font->h + 7) / 8) * font->w), font->w, font->h, color);
+  const ASCIIGlyph *glyph;
+  int16_t advance;
+  uint16_t key, k;
+  int16_t low, high, mid;
+
+  if (font->glyphs == NULL)
+    return font->w;
+  if (ch < ' ' || ch > '~')
+    return 0;
+
+  glyph = &font->glyphs[ch - ' '];
+  advance = (glyph->bearing >> 4) + glyph->w + (glyph->bearing & 0x0F);
+  if (next == 0 || font->kern == NULL)
+    return advance;
+
+  key = ((uint8_t)ch << 8) | (uint8_t)next;
+  low = 0;
+  high = font->kernCount - 1;
+  while (low <= high)
+  {
+    mid = (low + high) / 2;
+    k = ((uint8_t)font->kern[mid].left << 8) | (uint8_t)font->kern[mid].right;
+    if (k == key)
+      return advance + font->kern[mid].adjust;
+    if (k < key)
+      low = mid + 1;
+    else
+      high = mid - 1;
+  }
+  return advance;
 }
 
 /**
@@ -666,14 +1522,34 @@ void OLED_PrintASCIIChar(uint8_t x, uint8_t y, char ch, const ASCIIFont *font, O
  * @param font 字体
  * @param color 颜色
  */
-void OLED_PrintASCIIString(uint8_t x, uint8_t y, char *str, const ASCIIFont *font, OLED_ColorMode color)
+void OLED_PrintASCIIString(int16_t x, int16_t y, char *str, const ASCIIFont *font, OLED_ColorMode color)
 {
-  uint8_t x0 = x;
-  while (*str)
+  int16_t x0 = x;
+
+  if (font->glyphs == NULL && !font->packed)
   {
-    OLED_PrintASCIIChar(x0, y, *str, font, color);
-    x0 += font->w;
-    str++;
+    while (*str)
+    {
+      OLED_PrintASCIIChar(x0, y, *str, font, color);
+      x0 += font->w;
+      str++;
+    }
+    return;
+  }
+
+  // 比例字体或压缩字体: 先填充整个字符串的背景, 再逐个叠加字模 (只写有笔画的字节)
+  // 字距调整后相邻字符的留白可能重叠, 所以不能逐字覆盖
+  for (char *p = str; *p; p++)
+    x0 += OLED_GetASCIIAdvance(font, p[0], p[1]);
+  OLED_FillAreaOp(x, y, x0 - x, font->h, color ? OLED_ROP_OR : OLED_ROP_CLEAR);
+
+  x0 = x;
+  for (; *str; str++)
+  {
+    if (*str < ' ' || *str > '~')
+      continue;
+    OLED_DrawGlyph(x0, y, font, *str, color);
+    x0 += OLED_GetASCIIAdvance(font, str[0], str[1]);
   }
 }
 
@@ -702,17 +1578,50 @@ uint8_t _OLED_GetUTF8Len(char *string)
 }
 
 /**
- * @brief 绘制字符串
- * @param x 起始点横坐标
- * @param y 起始点纵坐标
- * @param str 字符串
+ * @brief 在字库中查找一个字
  * @param font 字体
- * @param color 颜色
- *
- * @note 为保证字符串中的中文会被自动识别并绘制, 需:
- * 1. 编译器字符集设置为UTF-8
- * 2. 使用波特律动LED取模工具生成字模(https://led.baud-dance.com)
+ * @param str 字符的utf8编码
+ * @param utf8Len 编码长度
+ * @return 字模头指针(前4字节为utf8编码), 没有时返回NULL
+ * @note 字库已排序时二分查找: 编码不足4字节的部分补0后按字节比较, 顺序与utf8编码(也就是Unicode码点)的顺序相同
  */
+static const uint8_t *OLED_FindChar(const Font *font, char *str, uint8_t utf8Len)
+{
+  uint16_t oneLen = (((font->h + 7) / 8) * font->w) + 4; // 一个字模占多少字节
+  const uint8_t *head;
+  uint8_t key[4] = {0};
+  uint16_t lo, hi, mid;
+  int cmp;
+
+  if (!font->sorted)
+  {
+    for (uint16_t j = 0; j < font->len; j++)
+    {
+      head = font->chars + (j * oneLen);
+      if (memcmp(str, head, utf8Len) == 0)
+        return head;
+    }
+    return NULL;
+  }
+
+  memcpy(key, str, utf8Len);
+  lo = 0;
+  hi = font->len;
+  while (lo < hi)
+  {
+    mid = (lo + hi) / 2;
+    head = font->chars + (mid * oneLen);
+    cmp = memcmp(key, head, 4);
+    if (cmp == 0)
+      return head;
+    if (cmp < 0)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return NULL;
+}
+
 /**
  * @brief 绘制字符串
  * @param x 起始点横坐标
@@ -725,49 +1634,41 @@ uint8_t _OLED_GetUTF8Len(char *string)
  * 1. 编译器字符集设置为UTF-8
  * 2. 使用波特律动LED取模工具生成字模(https://led.baud-dance.com)
  */
-void OLED_PrintString(uint8_t x, uint8_t y, char *str, const Font *font, OLED_ColorMode color)
+void OLED_PrintString(int16_t x, int16_t y, char *str, const Font *font, OLED_ColorMode color)
 {
-  uint16_t i = 0;                                       // 字符串索引
-  uint8_t oneLen = (((font->h + 7) / 8) * font->w) + 4; // 一个字模占多少字节
-  uint8_t found;                                        // 是否找到字模
-  uint8_t utf8Len;                                      // UTF-8编码长度
-  uint8_t *head;                                        // 字模头指针
+  uint16_t i = 0;      // 字符串索引
+  uint8_t utf8Len;     // UTF-8编码长度
+  const uint8_t *head; // 字模头指针
   while (str[i])
   {
-    found = 0;
     utf8Len = _OLED_GetUTF8Len(str + i);
     if (utf8Len == 0)
       break; // 有问题的UTF-8编码
 
-    // 寻找字符  TODO 优化查找算法, 二分查找或者hash
-    for (uint8_t j = 0; j < font->len; j++)
+    // 寻找字符
+    head = OLED_FindChar(font, str + i, utf8Len);
+    if (head)
     {
-      head = (uint8_t *)(font->chars) + (j * oneLen);
-      if (memcmp(str + i, head, utf8Len) == 0)
-      {
-        OLED_SetBlock(x, y, head + 4, font->w, font->h, color);
-        // 移动光标
-        x += font->w;
-        i += utf8Len;
-        found = 1;
-        break;
-      }
+      OLED_SetBlock(x, y, head + 4, font->w, font->h, color);
+      // 移动光标
+      x += font->w;
+      i += utf8Len;
     }
 
     // 若未找到字模,且为ASCII字符, 则缺省显示ASCII字符
-    if (found == 0)
+    else
     {
       if (utf8Len == 1)
       {
         OLED_PrintASCIIChar(x, y, str[i], font->ascii, color);
         // 移动光标
-        x += font->ascii->w;
+        x += OLED_GetASCIIAdvance(font->ascii, str[i], 0);
         i += utf8Len;
       }
       else
       {
         OLED_PrintASCIIChar(x, y, ' ', font->ascii, color);
-        x += font->ascii->w;
+        x += OLED_GetASCIIAdvance(font->ascii, ' ', 0);
         i += utf8Len;
       }
     }
@@ -826,61 +1727,109 @@ void OLED_SetBrightness(int16_t brightness)
     // 5. 组合拳：同时调节 预充电周期(0xD9) 和 泵电压(0x30-0x33)
     // SH1106 特有指令 0x30~0x33: Set VPP (6.4V ~ 9.0V)
     
+    OLED_CmdBegin();
     if (brightness < 128) 
     {
         // [低亮度区间]
         // 降低驱动电压 (7.4V)
-        OLED_SendCmd(0x31); 
+        OLED_CmdPush(0x31); 
         // 极短的预充电时间
-        OLED_SendCmd(0xD9); 
-        OLED_SendCmd(0x11); 
+        OLED_CmdPush(0xD9); 
+        OLED_CmdPush(0x11); 
     } 
     else if (brightness < 200) 
     {
         // [中亮度区间]
         // 中等驱动电压 (8.0V)
-        OLED_SendCmd(0x32);
+        OLED_CmdPush(0x32);
         // 标准预充电
-        OLED_SendCmd(0xD9); 
-        OLED_SendCmd(0x22); 
+        OLED_CmdPush(0xD9); 
+        OLED_CmdPush(0x22); 
     }
     else 
     {
         // [高亮度区间]
         // 最高驱动电压 (9.0V) -> 只有这时候才火力全开
-        OLED_SendCmd(0x33); 
+        OLED_CmdPush(0x33); 
         // 标准预充电
-        OLED_SendCmd(0xD9); 
-        OLED_SendCmd(0x22); 
+        OLED_CmdPush(0xD9); 
+        OLED_CmdPush(0x22); 
     }
 
     // 6. 最后发送计算好的对比度
-    OLED_SendCmd(0x81);
-    OLED_SendCmd(contrast);
+    OLED_CmdPush(0x81);
+    OLED_CmdPush(contrast);
+    OLED_CmdFlush(); // 以上指令一次发出
 }
 
+/**
+ * @brief 登记字符串中的汉字, 加入当前的批量预取
+ * @param str GBK字符串
+ * @param size 字号, 与之后OLED_ShowGBK用的相同
+ * @note 在GlyphCache_BatchBegin()和GlyphCache_BatchEnd()之间调用: 先登记几行文字, 再逐行OLED_ShowGBK,
+ *       第一次OLED_ShowGBK时取齐所有行的字, 并钉在缓存中直到BatchEnd, 后面的行不会把前面的字挤掉
+ */
+void OLED_PrefetchGBK(char *str, uint8_t size){
+    uint32_t addr;
+    uint16_t code;
+    uint16_t bytes;
+
+    if (FontPack_GetGlyphBytes(size) == 0) size = 16; // 与OLED_ShowGBK相同
+    bytes = FontPack_GetGlyphBytes(size);
+
+    while (*str)
+    {
+        if ((uint8_t)*str < 0x80) { str++; continue; }
+        if (str[1] == '\0') break;
+        code = ((uint8_t)str[0] << 8) | (uint8_t)str[1];
+        addr = FontPack_GetGlyphAddr(size, code);
+        if (addr != FONT_PACK_NONE) GlyphCache_BatchAdd(size, code, addr, bytes);
+        str += 2;
+    }
+}
+
+/**
+ * @brief 显示GBK编码的中英文混合字符串 (汉字点阵在外部Flash中)
+ * @param x 起始点横坐标
+ * @param y 起始点纵坐标
+ * @param str GBK字符串
+ * @param size 字号 12/16/24/32; 字库中没有这个字号时用16号
+ * @param mode 颜色模式
+ * @note 英文字符用内置ASCII字体: 12号用12x6, 16号用16x8, 24/32号用24x12(在行内垂直居中)
+ * @note 分两步: 先取齐整个字符串要用的字(钉在缓存中), 再逐个绘制
+ */
 void OLED_ShowGBK(uint8_t x, uint8_t y, char *str, uint8_t size, OLED_ColorMode mode){
-    static uint8_t buffer[32];
+    const uint8_t *glyph;
+    const ASCIIFont *ascii;
     uint32_t i = 0;
-    
-    // 每一页（分卷）的理论大小，由 Python 脚本算法反推得出
-    // Total 261696 / 7 ≈ 37386
-    const uint32_t PAGE_SIZE = 37386; 
+    uint32_t addr;
+    uint16_t bytes;
+
+    if (FontPack_GetGlyphBytes(size) == 0) size = 16; // 没有这个字号
+
+    uint8_t w = FontPack_GetGlyphWidth(size);
+    uint8_t h = size;
+    bytes = FontPack_GetGlyphBytes(size);
+    if (w == 0 || bytes > GLYPH_CACHE_LARGE_BYTES) return; // 字库中连16号字都没有
 
-    // 每经过一页，增加的偏移量 (你测出来的)
-    const uint8_t GAP_PER_PAGE = 10;
+    if (size <= 12) ascii = &afont12x6;
+    else if (size <= 16) ascii = &afont16x8;
+    else ascii = &afont24x12;
 
-    uint8_t w = 16;
-    uint8_t h = 16;
+    // 第一步: 取字
+    GlyphCache_BatchBegin();
+    OLED_PrefetchGBK(str, size);
+    GlyphCache_BatchFetch();
 
+    // 第二步: 绘制
     while (str[i])
     {
         // ----------------- 1. ASCII 处理 -----------------
         if ((uint8_t)str[i] < 0x80)
         {
             if (str[i] == '\n') { x = 0; y += h; i++; continue; }
-            OLED_PrintASCIIChar(x, y, str[i], &afont16x8, mode);
-            x += 8;
+            OLED_PrintASCIIChar(x, y + (h - ascii->h) / 2, str[i], ascii, mode);
+            x += OLED_GetASCIIAdvance(ascii, str[i], 0);
             i++;
         }
         // ----------------- 2. 中文处理 -----------------
@@ -890,26 +1839,15 @@ void OLED_ShowGBK(uint8_t x, uint8_t y, char *str, uint8_t size, OLED_ColorMode
             uint8_t H = (uint8_t)str[i];
             uint8_t L = (uint8_t)str[i+1];
 
-            if (H >= 0xA1 && L >= 0xA1)
+            // 1. 由字库头部算出地址 (不在字库中的编码不显示, 只占位)
+            addr = FontPack_GetGlyphAddr(size, (H << 8) | L);
+            if (addr != FONT_PACK_NONE)
             {
-                // 1. 基础地址计算
-                uint32_t index = ((H - 0xA1) * 94) + (L - 0xA1);
-                uint32_t addr = index * 32;
-
-                // 2. 【核心魔法】计算属于第几页，并加上对应的累计偏移
-                // 例如：
-                // 第0页 (0-37385):   page_idx = 0, +0
-                // 第1页 (37386-xxxx): page_idx = 1, +10 ("啊"在这里)
-                // 第2页 (xxxx-xxxx):  page_idx = 2, +20 ("何"在这里)
+                // 2. 读取数据 (最近用过的字直接从RAM缓存中取, 否则一次连续读出整个字)
+                glyph = GlyphCache_Get(size, (H << 8) | L, addr, bytes);
                 
-                uint32_t page_idx = addr / PAGE_SIZE;
-                addr += (page_idx * GAP_PER_PAGE);
-
-                // 3. 读取数据
-                W25Q_Read(buffer, addr, 32);
-                
-                // 4. 显示
-                OLED_SetBlock(x, y, buffer, w, h, mode);
+                // 3. 显示
+                OLED_SetBlock(x, y, glyph, w, h, mode);
             }
 
             x += w; 
@@ -918,4 +1856,5 @@ void OLED_ShowGBK(uint8_t x, uint8_t y, char *str, uint8_t size, OLED_ColorMode
         
         if (x > 128 - w) { x = 0; y += h; }
     }
-}
\ No newline at end of file
+    GlyphCache_BatchEnd();
+}
@@ -3,6 +3,7 @@
 
 #include "font.h"
 #include "main.h"
+#include "oled_port.h"
 #include "string.h"
 #include "stdint.h"
 
@@ -11,6 +12,25 @@ typedef enum {
   OLED_COLOR_REVERSED    // 反色模式 白底黑字
 } OLED_ColorMode;
 
+typedef enum {
+  OLED_ROP_COPY = 0, // 覆盖 显存 = 数据
+  OLED_ROP_OR,       // 叠加 显存 |= 数据
+  OLED_ROP_CLEAR,    // 擦除 显存 &= ~数据
+  OLED_ROP_XOR       // 取反 显存 ^= 数据
+} OLED_RasterOp;
+
+/**
+ * @brief 画布 (离屏绘图缓冲区)
+ * @note 数据与显存一样按页排列: buf[页 * w + 列], 大小为 OLED_CANVAS_SIZE(w, h)
+ */
+typedef struct Canvas {
+  uint8_t w;    // 宽度
+  uint8_t h;    // 高度
+  uint8_t *buf; // 数据
+} Canvas;
+
+#define OLED_CANVAS_SIZE(w, h) ((w) * (((h) + 7) / 8))
+
 
 // 设置屏幕亮度 (0-255)
 void OLED_SetBrightness(int16_t brightness);
@@ -18,9 +38,26 @@ void OLED_Init();
 void OLED_DisPlay_On();
 void OLED_DisPlay_Off();
 
+void OLED_CmdBegin();
+void OLED_CmdPush(uint8_t cmd);
+void OLED_CmdFlush();
+
 void OLED_NewFrame();
+void OLED_SetTarget(Canvas *canvas);
+void OLED_ClearCanvas(Canvas *canvas);
+void OLED_DrawCanvas(int16_t x, int16_t y, const Canvas *canvas, OLED_RasterOp op);
 void OLED_ShowFrame();
+void OLED_ShowFrameAsync();
+uint8_t OLED_IsFrameBusy();
+void OLED_WaitFrame();
+uint16_t OLED_GetFrameBytes();
 void OLED_SetPixel(uint8_t x, uint8_t y, OLED_ColorMode color);
+void OLED_FillArea(int16_t x, int16_t y, int16_t w, int16_t h, OLED_ColorMode color);
+void OLED_FillAreaOp(int16_t x, int16_t y, int16_t w, int16_t h, OLED_RasterOp op);
+void OLED_InvertArea(int16_t x, int16_t y, int16_t w, int16_t h);
+void OLED_SetBlock(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, OLED_ColorMode color);
+void OLED_SetBlockOp(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, OLED_RasterOp op);
+void OLED_SetBlockRotated(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, OLED_RasterOp op);
 
 void OLED_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, OLED_ColorMode color);
 void OLED_DrawRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, OLED_ColorMode color);
@@ -30,11 +67,15 @@ void OLED_DrawFilledTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uin
 void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r, OLED_ColorMode color);
 void OLED_DrawFilledCircle(uint8_t x, uint8_t y, uint8_t r, OLED_ColorMode color);
 void OLED_DrawEllipse(uint8_t x, uint8_t y, uint8_t a, uint8_t b, OLED_ColorMode color);
-void OLED_DrawImage(uint8_t x, uint8_t y, const Image *img, OLED_ColorMode color);
+void OLED_DrawFilledEllipse(uint8_t x, uint8_t y, uint8_t a, uint8_t b, OLED_ColorMode color);
+void OLED_DrawImage(int16_t x, int16_t y, const Image *img, OLED_ColorMode color);
+void OLED_DrawImageOp(int16_t x, int16_t y, const Image *img, OLED_RasterOp op);
 
-void OLED_PrintASCIIChar(uint8_t x, uint8_t y, char ch, const ASCIIFont *font, OLED_ColorMode color);
-void OLED_PrintASCIIString(uint8_t x, uint8_t y, char *str, const ASCIIFont *font, OLED_ColorMode color);
-void OLED_PrintString(uint8_t x, uint8_t y, char *str, const Font *font, OLED_ColorMode color);
+void OLED_PrintASCIIChar(int16_t x, int16_t y, char ch, const ASCIIFont *font, OLED_ColorMode color);
+void OLED_PrintASCIIString(int16_t x, int16_t y, char *str, const ASCIIFont *font, OLED_ColorMode color);
+int16_t OLED_GetASCIIAdvance(const ASCIIFont *font, char ch, char next);
+void OLED_PrintString(int16_t x, int16_t y, char *str, const Font *font, OLED_ColorMode color);
+void OLED_PrefetchGBK(char *str, uint8_t size);
 void OLED_ShowGBK(uint8_t x, uint8_t y, char *str, uint8_t size, OLED_ColorMode mode);
 
 
@@ -0,0 +1,26 @@
+#ifndef __OLED_PORT_H__
+#define __OLED_PORT_H__
+
+#include "stdint.h"
+
+/**
+ * @brief OLED底层通信接口
+ * @note oled.c不直接访问I2C, 所有发送都经过这里的函数
+ * @note 移植到其他平台(或在PC上模拟)时, 实现一组接口并在OLED_Init()之前调用OLED_SetPort()
+ */
+typedef struct OLED_Port {
+  // 阻塞发送 控制字节ctrl(0x00:后面全是指令 0x40:后面全是显存数据) + len字节数据, 成功返回0
+  uint8_t (*write)(uint8_t ctrl, const uint8_t *data, uint16_t len);
+  // 后台发送 启动后立即返回(成功返回0), 发送完成或出错时由底层调用OLED_Port_TxDone()
+  uint8_t (*writeAsync)(uint8_t ctrl, const uint8_t *data, uint16_t len);
+  // 总线卡死(一帧超时)时调用, 复位总线
+  void (*recover)(void);
+} OLED_Port;
+
+void OLED_SetPort(const OLED_Port *port);
+void OLED_Port_TxDone(uint8_t ok);
+
+// STM32 I2C1 实现 (oled_port_stm32.c)
+extern const OLED_Port OLED_PortSTM32;
+
+#endif // __OLED_PORT_H__
@@ -0,0 +1,55 @@
+/**
+ * @file oled_port_stm32.c
+ * @brief OLED底层通信接口的STM32实现 (硬件I2C1)
+ * @note 控制字节作为"寄存器地址"发出, 线上时序与先发控制字节再发数据完全相同,
+ *       这样数据可以直接从显存发送, 不需要再拷贝到带控制字节的缓冲区
+ */
+#include "oled_port.h"
+#include "i2c.h"
+
+// OLED器件地址
+#define OLED_ADDRESS 0x78
+
+static uint8_t OLED_STM32_Write(uint8_t ctrl, const uint8_t *data, uint16_t len)
+{
+  return HAL_I2C_Mem_Write(&hi2c1, OLED_ADDRESS, ctrl, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, len, HAL_MAX_DELAY) != HAL_OK;
+}
+
+static uint8_t OLED_STM32_WriteAsync(uint8_t ctrl, const uint8_t *data, uint16_t len)
+{
+  return HAL_I2C_Mem_Write_IT(&hi2c1, OLED_ADDRESS, ctrl, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, len) != HAL_OK;
+}
+
+static void OLED_STM32_Recover(void)
+{
+  HAL_I2C_DeInit(&hi2c1);
+  HAL_I2C_Init(&hi2c1);
+}
+
+/**
+ * @brief I2C发送完成中断回调
+ */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c1)
+  {
+    OLED_Port_TxDone(1);
+  }
+}
+
+/**
+ * @brief I2C错误中断回调
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c1)
+  {
+    OLED_Port_TxDone(0);
+  }
+}
+
+const OLED_Port OLED_PortSTM32 = {
+    OLED_STM32_Write,
+    OLED_STM32_WriteAsync,
+    OLED_STM32_Recover,
+};
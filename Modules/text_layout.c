@@ -0,0 +1,179 @@
+/**
+ * @file text_layout.c
+ * @brief 文字测量与排版
+ * @note 计算一个字符串画出来有多宽、分几行、每个字符在哪里, 规则与实际绘制函数完全相同:
+ *       - ascii非NULL: OLED_PrintASCIIString, 不换行 (比例字体按前进量和字距调整)
+ *       - ascii为NULL: OLED_ShowGBK(size), GBK双字节汉字 + ASCII, 遇到'\n'或超出屏幕宽度时换行
+ * @note 排版从第0列开始计算, 所以换行位置与从第0列开始绘制时相同; 单行文字的宽度与起点无关, 可直接用于居中.
+ * @note Text_Layout()按字符串指针缓存结果, 只用于内容不变的字符串(菜单名、标题等);
+ *       内容会变的缓冲区请用Text_Measure()或Text_LayoutTo(), 或在内容改变后调用Text_Invalidate().
+ */
+#include "text_layout.h"
+#include "font_pack.h"
+#include "oled.h"
+
+#define TEXT_SCREEN_WIDTH 128
+
+static TextLayout Text_Cache[TEXT_LAYOUT_CACHE_SIZE];
+static uint8_t Text_CacheNext; // 下一个被替换的位置 (轮流替换)
+
+/**
+ * @brief 取OLED_ShowGBK在某字号下实际使用的字号、汉字宽度和ASCII字体 (与OLED_ShowGBK相同)
+ * @return 汉字宽度, 字库中连16号字都没有时返回0
+ */
+static uint8_t Text_ResolveGBK(uint8_t *size, const ASCIIFont **ascii)
+{
+  if (FontPack_GetGlyphBytes(*size) == 0)
+    *size = 16;
+  if (*size <= 12)
+    *ascii = &afont12x6;
+  else if (*size <= 16)
+    *ascii = &afont16x8;
+  else
+    *ascii = &afont24x12;
+  return FontPack_GetGlyphWidth(*size);
+}
+
+/**
+ * @brief 排版
+ * @param layout 结果, 可以为NULL(只返回宽度)
+ * @return 最宽一行的宽度
+ */
+static uint8_t Text_Run(TextLayout *layout, const char *str, const ASCIIFont *ascii, uint8_t size)
+{
+  uint16_t x = 0, y = 0, width = 0;
+  uint8_t lines = 1, count = 0;
+  uint8_t h, cw, gw = 0;
+  uint8_t step; // 当前字符的字节数
+  uint16_t i = 0;
+  uint8_t gbk = (ascii == NULL);
+  const char *text = str; // 实际排版的内容, layout->str仍记录调用者传入的指针 (Text_Layout按指针查缓存)
+
+  if (gbk)
+  {
+    gw = Text_ResolveGBK(&size, &ascii);
+    h = size;
+    if (gw == 0) // 字库中连16号字都没有, OLED_ShowGBK不绘制
+      text = "";
+  }
+  else
+  {
+    h = ascii->h;
+  }
+
+  while (text[i])
+  {
+    if (gbk && text[i] == '\n')
+    {
+      x = 0;
+      y += h;
+      lines++;
+      i++;
+      continue;
+    }
+    if (gbk && (uint8_t)text[i] >= 0x80)
+    {
+      if (text[i + 1] == '\0')
+        break;
+      cw = gw;
+      step = 2;
+    }
+    else
+    {
+      // OLED_PrintASCIIString按字距调整表排版, OLED_ShowGBK逐字绘制不调整
+      cw = OLED_GetASCIIAdvance(ascii, text[i], gbk ? 0 : text[i + 1]);
+      step = 1;
+    }
+
+    if (layout && count < TEXT_LAYOUT_MAX_GLYPHS)
+    {
+      layout->glyphs[count].x = x;
+      layout->glyphs[count].y = y;
+      layout->glyphs[count].w = cw;
+      layout->glyphs[count].offset = i;
+      count++;
+    }
+    x += cw;
+    i += step;
+    if (x > width)
+      width = x;
+
+    // OLED_ShowGBK: 放不下下一个汉字时换行
+    if (gbk && x > TEXT_SCREEN_WIDTH - gw && text[i])
+    {
+      x = 0;
+      y += h;
+      lines++;
+    }
+  }
+
+  if (width > 255)
+    width = 255;
+  if (layout)
+  {
+    layout->str = str;
+    layout->width = width;
+    layout->height = (y + h > 255) ? 255 : y + h;
+    layout->lines = lines;
+    layout->count = count;
+  }
+  return width;
+}
+
+/**
+ * @brief 测量字符串的宽度 (多行时为最宽一行)
+ * @param str 字符串
+ * @param ascii 非NULL: 按OLED_PrintASCIIString(ascii)测量 NULL: 按OLED_ShowGBK(size)测量
+ * @param size GBK字号 (ascii为NULL时有效)
+ * @return 宽度(像素)
+ */
+uint8_t Text_Measure(const char *str, const ASCIIFont *ascii, uint8_t size)
+{
+  return Text_Run(NULL, str, ascii, size);
+}
+
+/**
+ * @brief 排版到调用者提供的结构体 (不缓存)
+ */
+void Text_LayoutTo(TextLayout *layout, const char *str, const ASCIIFont *ascii, uint8_t size)
+{
+  Text_Run(layout, str, ascii, size);
+  layout->ascii = ascii;
+  layout->size = size;
+}
+
+/**
+ * @brief 排版 结果按字符串指针缓存
+ * @param str 内容不变的字符串
+ * @return 排版结果, 在下一次替换该缓存位置之前有效
+ */
+const TextLayout *Text_Layout(const char *str, const ASCIIFont *ascii, uint8_t size)
+{
+  TextLayout *layout;
+
+  for (uint8_t i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+  {
+    layout = &Text_Cache[i];
+    if (layout->str == str && layout->ascii == ascii && layout->size == size)
+      return layout;
+  }
+
+  layout = &Text_Cache[Text_CacheNext];
+  if (++Text_CacheNext >= TEXT_LAYOUT_CACHE_SIZE)
+    Text_CacheNext = 0;
+  Text_LayoutTo(layout, str, ascii, size);
+  return layout;
+}
+
+/**
+ * @brief 字符串内容改变后, 丢弃它的缓存结果
+ * @param str 字符串, NULL表示清空全部缓存
+ */
+void Text_Invalidate(const char *str)
+{
+  for (uint8_t i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+  {
+    if (str == NULL || Text_Cache[i].str == str)
+      Text_Cache[i].str = NULL;
+  }
+}
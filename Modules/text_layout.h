@@ -0,0 +1,38 @@
+#ifndef __TEXT_LAYOUT_H__
+#define __TEXT_LAYOUT_H__
+
+#include "font.h"
+#include "stdint.h"
+
+// 排版结果中最多记录的字符位置数 (超出的字符只计入宽度和行数)
+#define TEXT_LAYOUT_MAX_GLYPHS 20
+
+// 按字符串指针缓存的排版结果个数 每个约 TEXT_LAYOUT_MAX_GLYPHS * 4 + 16 字节RAM
+#ifndef TEXT_LAYOUT_CACHE_SIZE
+#define TEXT_LAYOUT_CACHE_SIZE 6
+#endif
+
+typedef struct TextGlyph {
+  uint8_t x;      // 相对排版起点的位置
+  uint8_t y;
+  uint8_t w;      // 字符宽度
+  uint8_t offset; // 在字符串中的字节位置
+} TextGlyph;
+
+typedef struct TextLayout {
+  const char *str;         // 排版的字符串
+  const ASCIIFont *ascii;  // 非NULL: 按OLED_PrintASCIIString排版 NULL: 按OLED_ShowGBK排版
+  uint8_t size;            // GBK字号 (ascii为NULL时有效)
+  uint8_t width;           // 最宽一行的宽度
+  uint8_t height;          // 总高度
+  uint8_t lines;           // 行数
+  uint8_t count;           // glyphs中记录的字符数
+  TextGlyph glyphs[TEXT_LAYOUT_MAX_GLYPHS];
+} TextLayout;
+
+uint8_t Text_Measure(const char *str, const ASCIIFont *ascii, uint8_t size);
+void Text_LayoutTo(TextLayout *layout, const char *str, const ASCIIFont *ascii, uint8_t size);
+const TextLayout *Text_Layout(const char *str, const ASCIIFont *ascii, uint8_t size);
+void Text_Invalidate(const char *str);
+
+#endif // __TEXT_LAYOUT_H__
@@ -0,0 +1,163 @@
+/**
+ * @file text_strip.c
+ * @brief 预渲染文字条缓存
+ * @note 菜单名、标题这类内容不变的字符串, 第一次绘制时画到一条16像素高的离屏数据上, 按字符串指针缓存,
+ *       之后每帧只需一次贴图, 不再逐字查字体、读Flash.
+ * @note 文字条只保存正常显示的一份, 反色显示由贴图时取反得到 (OLED_SetBlock), 不额外占用RAM.
+ * @note 所有文字条放在一块 TEXT_STRIP_BUDGET 字节的缓冲区中, 按先进先出循环分配, 放不下时覆盖最早的文字条.
+ * @note 字符串内容改变(或字库改变)后需调用TextStrip_Invalidate().
+ */
+#include "text_strip.h"
+#include "text_layout.h"
+
+typedef struct TextStripEntry {
+  const char *str;        // 字符串 NULL表示空位置
+  const ASCIIFont *ascii; // 非NULL: 按OLED_PrintASCIIString绘制 NULL: 按OLED_ShowGBK绘制
+  uint8_t size;           // GBK字号
+  uint8_t w;              // 宽度
+  uint16_t offset;        // 在TextStrip_Buf中的位置
+} TextStripEntry;
+
+static uint8_t TextStrip_Buf[TEXT_STRIP_BUDGET];
+static TextStripEntry TextStrip_Entries[TEXT_STRIP_ENTRIES];
+static uint16_t TextStrip_Head;     // 下一次分配的位置
+static uint8_t TextStrip_NextEntry; // 下一个被替换的位置 (轮流替换)
+static uint32_t TextStrip_Hits;
+static uint32_t TextStrip_Misses;
+
+/**
+ * @brief 在缓冲区中分配一段空间, 覆盖与它重叠的文字条
+ */
+static uint16_t TextStrip_Alloc(uint16_t bytes)
+{
+  uint16_t offset, end;
+
+  if (TextStrip_Head + bytes > TEXT_STRIP_BUDGET)
+    TextStrip_Head = 0;
+  offset = TextStrip_Head;
+  TextStrip_Head += bytes;
+
+  for (uint8_t i = 0; i < TEXT_STRIP_ENTRIES; i++)
+  {
+    TextStripEntry *e = &TextStrip_Entries[i];
+    end = e->offset + e->w * (TEXT_STRIP_H / 8);
+    if (e->str && e->offset < offset + bytes && end > offset)
+      e->str = NULL;
+  }
+  return offset;
+}
+
+/**
+ * @brief 取一个字符串的文字条, 不在缓存中时先绘制
+ * @param str 内容不变的字符串
+ * @param ascii 非NULL: 按OLED_PrintASCIIString(ascii)绘制 NULL: 按OLED_ShowGBK(size)绘制
+ * @param size GBK字号 (ascii为NULL时有效)
+ * @param w 返回宽度
+ * @return 文字条数据 (按页排列, 2页 * w列), 字符串不能放进一个文字条(多行、太高、太宽)时返回NULL
+ * @note 未命中时要临时切换绘图目标, 不要在绘制到画布的过程中调用
+ */
+const uint8_t *TextStrip_Get(const char *str, const ASCIIFont *ascii, uint8_t size, uint8_t *w)
+{
+  const TextLayout *layout;
+  TextStripEntry *e;
+  Canvas canvas;
+  uint16_t bytes;
+
+  for (uint8_t i = 0; i < TEXT_STRIP_ENTRIES; i++)
+  {
+    e = &TextStrip_Entries[i];
+    if (e->str == str && e->ascii == ascii && e->size == size)
+    {
+      TextStrip_Hits++;
+      *w = e->w;
+      return &TextStrip_Buf[e->offset];
+    }
+  }
+  TextStrip_Misses++;
+
+  layout = Text_Layout(str, ascii, size);
+  bytes = layout->width * (TEXT_STRIP_H / 8);
+  if (layout->lines != 1 || layout->height > TEXT_STRIP_H || bytes == 0 || bytes > TEXT_STRIP_BUDGET)
+    return NULL;
+
+  e = &TextStrip_Entries[TextStrip_NextEntry];
+  if (++TextStrip_NextEntry >= TEXT_STRIP_ENTRIES)
+    TextStrip_NextEntry = 0;
+  e->str = NULL;
+  e->offset = TextStrip_Alloc(bytes);
+  e->w = layout->width;
+
+  // 绘制 内容垂直居中
+  canvas.w = e->w;
+  canvas.h = TEXT_STRIP_H;
+  canvas.buf = &TextStrip_Buf[e->offset];
+  OLED_ClearCanvas(&canvas);
+  OLED_SetTarget(&canvas);
+  if (ascii)
+    OLED_PrintASCIIString(0, (TEXT_STRIP_H - ascii->h) / 2, (char *)str, ascii, OLED_COLOR_NORMAL);
+  else
+    OLED_ShowGBK(0, (TEXT_STRIP_H - layout->height) / 2, (char *)str, size, OLED_COLOR_NORMAL);
+  OLED_SetTarget(NULL);
+
+  e->str = str;
+  e->ascii = ascii;
+  e->size = size;
+  *w = e->w;
+  return canvas.buf;
+}
+
+/**
+ * @brief 绘制一个内容不变的字符串
+ * @param x 起始横坐标
+ * @param y 文字条顶部的纵坐标 (文字在16像素高的文字条中垂直居中)
+ * @param str 内容不变的字符串
+ * @param ascii 非NULL: 按OLED_PrintASCIIString(ascii)绘制 NULL: 按OLED_ShowGBK(size)绘制
+ * @param size GBK字号 (ascii为NULL时有效)
+ * @param mode 颜色 OLED_COLOR_REVERSED时整个文字条(包括文字间的空白)白底黑字
+ * @return 宽度
+ * @note 文字条覆盖(OLED_ROP_COPY)它所在的16行, 与直接绘制文字的效果相同
+ * @note 不能放进文字条的字符串直接绘制
+ */
+uint8_t TextStrip_Draw(int16_t x, int16_t y, const char *str, const ASCIIFont *ascii, uint8_t size, OLED_ColorMode mode)
+{
+  const uint8_t *strip;
+  uint8_t w;
+
+  strip = TextStrip_Get(str, ascii, size, &w);
+  if (strip)
+  {
+    OLED_SetBlock(x, y, strip, w, TEXT_STRIP_H, mode);
+    return w;
+  }
+
+  if (ascii)
+    OLED_PrintASCIIString(x, y + (TEXT_STRIP_H - ascii->h) / 2, (char *)str, ascii, mode);
+  else
+    OLED_ShowGBK(x, y, (char *)str, size, mode);
+  return Text_Layout(str, ascii, size)->width;
+}
+
+/**
+ * @brief 丢弃字符串的文字条 (字符串内容改变后调用)
+ * @param str 字符串, NULL表示清空全部 (例如更换字库后)
+ */
+void TextStrip_Invalidate(const char *str)
+{
+  for (uint8_t i = 0; i < TEXT_STRIP_ENTRIES; i++)
+  {
+    if (str == NULL || TextStrip_Entries[i].str == str)
+      TextStrip_Entries[i].str = NULL;
+  }
+  if (str == NULL)
+    TextStrip_Head = 0;
+  Text_Invalidate(str);
+}
+
+/**
+ * @brief 获取命中统计
+ */
+void TextStrip_GetStats(uint32_t *hits, uint32_t *misses)
+{
+  *hits = TextStrip_Hits;
+  *misses = TextStrip_Misses;
+}
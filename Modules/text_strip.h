@@ -0,0 +1,25 @@
+#ifndef __TEXT_STRIP_H__
+#define __TEXT_STRIP_H__
+
+#include "oled.h"
+#include "stdint.h"
+
+// 文字条高度 (两页, 内容垂直居中)
+#define TEXT_STRIP_H 16
+
+// 预渲染文字条占用的RAM(字节) 每个文字条占 宽度 * 2 字节, 例如4个16号汉字占128字节
+#ifndef TEXT_STRIP_BUDGET
+#define TEXT_STRIP_BUDGET 1024
+#endif
+
+// 最多缓存的文字条个数
+#ifndef TEXT_STRIP_ENTRIES
+#define TEXT_STRIP_ENTRIES 16
+#endif
+
+const uint8_t *TextStrip_Get(const char *str, const ASCIIFont *ascii, uint8_t size, uint8_t *w);
+uint8_t TextStrip_Draw(int16_t x, int16_t y, const char *str, const ASCIIFont *ascii, uint8_t size, OLED_ColorMode mode);
+void TextStrip_Invalidate(const char *str);
+void TextStrip_GetStats(uint32_t *hits, uint32_t *misses);
+
+#endif // __TEXT_STRIP_H__
@@ -1,11 +1,61 @@
 #include "w25qxx.h"
-#include "spi.h" // CubeMXɵspi.h
+#include "spi.h" // 引入CubeMX生成的spi.h
 #include "stdint.h"
+#include "string.h"
+#include "flash_cache.h"
+#include "font_pack.h"
 
-// Ƭѡƺ
+// 片选控制宏
 #define W25Q_CS_LOW()  HAL_GPIO_WritePin(W25_CS_GPIO_Port, W25_CS_Pin, GPIO_PIN_RESET)
 #define W25Q_CS_HIGH() HAL_GPIO_WritePin(W25_CS_GPIO_Port, W25_CS_Pin, GPIO_PIN_SET)
-// SPIдһֽ
+
+// 一次SPI传输最多的字节数 (HAL的长度参数是16位) 和超时时间(ms)
+// 9MHz时 32KB 约需 30ms
+#define W25Q_SPI_CHUNK   0x8000
+#define W25Q_SPI_TIMEOUT 100
+
+// 自检: 参照数据用字库头部 (烧录过字库时以magic开头, 不是空白的0xFF), 以及测速读取的长度
+#define W25Q_TEST_ADDR   FONT_PACK_ADDR
+#define W25Q_TEST_BYTES  sizeof(FontPackHeader)
+#define W25Q_BENCH_BYTES 4096
+#define W25Q_BENCH_CHUNK 64
+
+static uint8_t W25Q_ReadCmd = W25X_ReadData; // 当前使用的读命令
+static uint8_t W25Q_ReadDummy = 0;           // 读命令地址后的空字节数
+static uint32_t W25Q_ReadSpeed = 0;          // 自检测得的读取速度 (字节/秒)
+static uint8_t W25Q_TestResult = W25Q_TEST_SLOW; // 自检结果
+
+// 擦除/写入的状态 (非阻塞擦除/写入用, 见 W25Q_Poll)
+#define W25Q_STATE_IDLE      0 // 空闲
+#define W25Q_STATE_BUSY      1 // 擦除/写入进行中
+#define W25Q_STATE_SUSPENDED 2 // 为了读取而暂停了擦除/写入
+static uint8_t W25Q_State = W25Q_STATE_IDLE;
+static uint32_t W25Q_BusyAddr, W25Q_BusyLen; // 正在擦除/写入的区域, 完成时从读缓存中去掉
+static uint32_t W25Q_ResumeCycle;            // 上次开始/恢复擦除/写入的时刻 (DWT周期计数)
+static uint32_t W25Q_ReadAddr;               // 连续读取的当前地址
+
+// 恢复后至少运行这么久才能再暂停: 数据手册要求恢复后 tSUS(20us) 内不能再暂停,
+// 而且间隔太短擦除/写入几乎没有进展, 连续读取时会一直完成不了; 取5倍留出余量
+#define W25Q_RESUME_MIN_US 100
+
+// 擦除/写入开始: 去掉读缓存中这段地址的数据
+// (暂停期间读到的可能是写了一半的数据, 完成时还要再去掉一次, 见 W25Q_Done)
+static void W25Q_Begin(uint32_t addr, uint32_t len)
+{
+    W25Q_BusyAddr = addr;
+    W25Q_BusyLen = len;
+    FlashCache_Invalidate(addr, len);
+    W25Q_State = W25Q_STATE_BUSY;
+    W25Q_ResumeCycle = DWT->CYCCNT;
+}
+
+// 擦除/写入完成
+static void W25Q_Done(void)
+{
+    FlashCache_Invalidate(W25Q_BusyAddr, W25Q_BusyLen);
+    W25Q_State = W25Q_STATE_IDLE;
+}
+// SPI读写一个字节
 uint8_t W25Q_SPI_SwapByte(uint8_t byte)
 {
     uint8_t r_byte;
@@ -13,13 +63,37 @@ uint8_t W25Q_SPI_SwapByte(uint8_t byte)
     return r_byte;
 }
 
-// ʼ
+// 发送 命令 + 24位地址 + dummy个空字节 (一次发送)
+static void W25Q_SendCmdAddr(uint8_t cmd, uint32_t addr, uint8_t dummy)
+{
+    uint8_t buf[5];
+    buf[0] = cmd;
+    buf[1] = (uint8_t)(addr >> 16);
+    buf[2] = (uint8_t)(addr >> 8);
+    buf[3] = (uint8_t)addr;
+    buf[4] = 0xFF;
+    HAL_SPI_Transmit(&hspi1, buf, 4 + dummy, W25Q_SPI_TIMEOUT);
+}
+
+// 修改SPI1的分频 (W25Q_CS_HIGH 时调用)
+static void W25Q_SetPrescaler(uint32_t prescaler)
+{
+    if (hspi1.Init.BaudRatePrescaler == prescaler) return;
+    hspi1.Init.BaudRatePrescaler = prescaler;
+    HAL_SPI_Init(&hspi1); // 只重新配置寄存器, 不会再调用MspInit
+}
+
+// 初始化
 void W25Q_Init(void)
 {
+    // DWT周期计数器: 自检测速和暂停擦除/写入的最短间隔用
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
     W25Q_CS_HIGH();
+    W25Q_SelfTest();
 }
 
-// ȡоƬID (W25Q128 Ӧ EF 40 18)
+// 读取芯片ID (W25Q128 应该是 EF 40 18)
 void W25Q_Read_ID(uint8_t *ID)
 {
     W25Q_CS_LOW();
@@ -30,7 +104,7 @@ void W25Q_Read_ID(uint8_t *ID)
     W25Q_CS_HIGH();
 }
 
-// дʹ
+// 写使能
 void W25Q_Write_Enable(void)
 {
     W25Q_CS_LOW();
@@ -38,7 +112,7 @@ void W25Q_Write_Enable(void)
     W25Q_CS_HIGH();
 }
 
-// ȴæµ (/д/Ҫȴ)
+// 等待忙碌 (读/写/擦除后需要等待)
 void W25Q_Wait_Busy(void)
 {
     uint8_t status;
@@ -46,60 +120,130 @@ void W25Q_Wait_Busy(void)
     W25Q_SPI_SwapByte(W25X_ReadStatusReg1);
     do {
         status = W25Q_SPI_SwapByte(0xFF);
-    } while ((status & 0x01) == 0x01); // ȴBUSYλ
+    } while ((status & 0x01) == 0x01); // 等待BUSY位清空
     W25Q_CS_HIGH();
 }
 
-// һ (4KB)
-void W25Q_Erase_Sector(uint32_t Dst_Addr)
+// 读状态寄存器1 (bit0: BUSY)
+static uint8_t W25Q_Read_Status(void)
 {
+    uint8_t status;
+    W25Q_CS_LOW();
+    W25Q_SPI_SwapByte(W25X_ReadStatusReg1);
+    status = W25Q_SPI_SwapByte(0xFF);
+    W25Q_CS_HIGH();
+    return status;
+}
+
+// 恢复被暂停的擦除/写入
+static void W25Q_Resume(void)
+{
+    W25Q_CS_LOW();
+    W25Q_SPI_SwapByte(W25X_Resume);
+    W25Q_CS_HIGH();
+    W25Q_State = W25Q_STATE_BUSY;
+    W25Q_ResumeCycle = DWT->CYCCNT;
+}
+
+// 读取前调用: 擦除/写入还没完成时先暂停 (芯片忙时不能读), 读取结束时 (W25Q_ReadStop) 恢复,
+// 所以只在读取期间暂停, 不会一直停到下一轮主循环.
+// 距离上次恢复不到 W25Q_RESUME_MIN_US 时先等待, 连续读取时擦除/写入也能一直有进展
+// 注意: 暂停期间读正在擦除/写入的区域得到的数据不确定, 由 W25Q_ReadContinue 检查
+static void W25Q_Suspend(void)
+{
+    uint32_t min_cycles = W25Q_RESUME_MIN_US * (SystemCoreClock / 1000000);
+
+    if (W25Q_State != W25Q_STATE_BUSY) return;
+    while (DWT->CYCCNT - W25Q_ResumeCycle < min_cycles)
+        ;
+    if (!(W25Q_Read_Status() & 0x01))
+    {
+        W25Q_Done(); // 已经完成了
+        return;
+    }
+    W25Q_CS_LOW();
+    W25Q_SPI_SwapByte(W25X_Suspend);
+    W25Q_CS_HIGH();
+    W25Q_Wait_Busy(); // 暂停最多需要20us
+    W25Q_State = W25Q_STATE_SUSPENDED;
+}
+
+// 查询擦除/写入是否还在进行 (不阻塞, 在主循环中调用)
+// 返回 1:进行中 0:空闲, 可以开始下一个擦除/写入
+uint8_t W25Q_Poll(void)
+{
+    if (W25Q_State == W25Q_STATE_BUSY && !(W25Q_Read_Status() & 0x01))
+        W25Q_Done();
+    return W25Q_State != W25Q_STATE_IDLE;
+}
+
+// 等待擦除/写入完成 (阻塞), 读取中途也可以调用 (见 W25Q_ReadContinue)
+void W25Q_Sync(void)
+{
+    if (W25Q_State == W25Q_STATE_SUSPENDED)
+        W25Q_Resume();
+    if (W25Q_State == W25Q_STATE_BUSY)
+    {
+        W25Q_Wait_Busy();
+        W25Q_Done();
+    }
+}
+
+// 开始擦除一个扇区 (4KB), 不等待完成
+void W25Q_Erase_Sector_Start(uint32_t Dst_Addr)
+{
+    W25Q_Sync();
     W25Q_Write_Enable();
-    W25Q_Wait_Busy();
-    
+
     W25Q_CS_LOW();
-    W25Q_SPI_SwapByte(W25X_SectorErase);
-    W25Q_SPI_SwapByte((uint8_t)((Dst_Addr) >> 16));
-    W25Q_SPI_SwapByte((uint8_t)((Dst_Addr) >> 8));
-    W25Q_SPI_SwapByte((uint8_t)Dst_Addr);
+    W25Q_SendCmdAddr(W25X_SectorErase, Dst_Addr, 0);
     W25Q_CS_HIGH();
-    
-    W25Q_Wait_Busy(); // ȴ
+    W25Q_Begin(Dst_Addr & ~0xFFFul, 4096);
+}
+
+// 擦除一个扇区 (4KB)
+void W25Q_Erase_Sector(uint32_t Dst_Addr)
+{
+    W25Q_Erase_Sector_Start(Dst_Addr);
+    W25Q_Sync(); // 等待擦除完成
 }
 
 void W25Q_Erase_Chip(void)
 {
+    W25Q_Sync();
     W25Q_Write_Enable();
-    W25Q_Wait_Busy();
     W25Q_CS_LOW();
-    W25Q_SPI_SwapByte(0x60); // Chip Erase ָ
+    W25Q_SPI_SwapByte(0x60); // Chip Erase 指令
     W25Q_CS_HIGH();
-    W25Q_Wait_Busy(); // ȫƬǳҪʮ
+    W25Q_Wait_Busy(); // 全片擦除非常慢，可能要几十秒 (不能暂停, 所以一直等待)
+    FlashCache_Invalidate(0, 0xFFFFFFFF);
 }
 
-// 2. ҳд (ԭģ͸Ϊ uint32_t Էһ)
-void W25Q_Write_Page(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
+// 开始写入一页 (不能跨页), 不等待完成
+void W25Q_Write_Page_Start(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
 {
+    W25Q_Sync();
     W25Q_Write_Enable();
     W25Q_CS_LOW();
-    W25Q_SPI_SwapByte(0x02); // Page Program
-    W25Q_SPI_SwapByte((uint8_t)((WriteAddr) >> 16));
-    W25Q_SPI_SwapByte((uint8_t)((WriteAddr) >> 8));
-    W25Q_SPI_SwapByte((uint8_t)WriteAddr);
-    while (NumByteToWrite--)
-    {
-        W25Q_SPI_SwapByte(*pBuffer);
-        pBuffer++;
-    }
+    W25Q_SendCmdAddr(W25X_PageProgram, WriteAddr, 0);
+    HAL_SPI_Transmit(&hspi1, pBuffer, NumByteToWrite, W25Q_SPI_TIMEOUT); // 一页最多256字节, 一次发完
     W25Q_CS_HIGH();
-    W25Q_Wait_Busy();
+    W25Q_Begin(WriteAddr, NumByteToWrite);
+}
+
+// 2. 基础页写入 (保持你原来的，但参数类型改为 uint32_t 以防万一)
+void W25Q_Write_Page(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
+{
+    W25Q_Write_Page_Start(pBuffer, WriteAddr, NumByteToWrite);
+    W25Q_Sync();
 }
 
-// 3. ġд뺯 (Զҳ)
-// ԭ W25Q_Write
+// 3. 【核心】无限制写入函数 (自动处理换页，不带擦除)
+// 用这个函数替代你原来的 W25Q_Write
 void W25Q_Write_NoCheck(uint8_t* pBuffer, uint32_t WriteAddr, uint32_t NumByteToWrite)
 {
     uint16_t pageremain;
-    pageremain = 256 - (WriteAddr % 256); // ǰҳʣֽ
+    pageremain = 256 - (WriteAddr % 256); // 当前页剩余字节数
 
     if (NumByteToWrite <= pageremain) pageremain = NumByteToWrite;
 
@@ -107,31 +251,177 @@ void W25Q_Write_NoCheck(uint8_t* pBuffer, uint32_t WriteAddr, uint32_t NumByteTo
     {
         W25Q_Write_Page(pBuffer, WriteAddr, pageremain);
         
-        if (NumByteToWrite == pageremain) break; // д
+        if (NumByteToWrite == pageremain) break; // 写完了
         
-        // ָͼ
+        // 调整指针和计数器
         pBuffer += pageremain;
         WriteAddr += pageremain;
         NumByteToWrite -= pageremain;
         
-        // һдһҳ(256)ʣµ
+        // 下一次写满一页(256)或者剩下的
         if (NumByteToWrite > 256) pageremain = 256;
         else pageremain = NumByteToWrite;
     }
 }
-// ȡ
-void W25Q_Read(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead)
+// 开始连续读取: 拉低片选, 发送读命令和起始地址
+// 之后可以多次调用 W25Q_ReadContinue, 地址自动递增, 最后调用 W25Q_ReadStop
+void W25Q_ReadStart(uint32_t ReadAddr)
 {
+    W25Q_Suspend();
+    W25Q_ReadAddr = ReadAddr;
     W25Q_CS_LOW();
-    W25Q_SPI_SwapByte(W25X_ReadData);
-    W25Q_SPI_SwapByte((uint8_t)((ReadAddr) >> 16));
-    W25Q_SPI_SwapByte((uint8_t)((ReadAddr) >> 8));
-    W25Q_SPI_SwapByte((uint8_t)ReadAddr);
-    
-    while (NumByteToRead--)
+    W25Q_SendCmdAddr(W25Q_ReadCmd, ReadAddr, W25Q_ReadDummy);
+}
+
+// 继续读取 pBuffer 为 NULL 时丢弃读到的数据 (用来跳过一小段)
+// 数据整块接收 (HAL_SPI_Receive), 不再每个字节调用一次HAL
+void W25Q_ReadContinue(uint8_t* pBuffer, uint32_t NumByteToRead)
+{
+    uint8_t skip[16];
+    uint16_t n;
+
+    // 暂停期间读正在擦除/写入的区域得到的数据不确定 (擦了一半或写了一半):
+    // 先恢复并等它完成, 再从当前地址重新开始读
+    if (W25Q_State == W25Q_STATE_SUSPENDED &&
+        W25Q_ReadAddr < W25Q_BusyAddr + W25Q_BusyLen && W25Q_BusyAddr < W25Q_ReadAddr + NumByteToRead)
+    {
+        W25Q_CS_HIGH();
+        W25Q_Sync();
+        W25Q_CS_LOW();
+        W25Q_SendCmdAddr(W25Q_ReadCmd, W25Q_ReadAddr, W25Q_ReadDummy);
+    }
+    W25Q_ReadAddr += NumByteToRead;
+
+    while (NumByteToRead)
     {
-        *pBuffer = W25Q_SPI_SwapByte(0xFF);
-        pBuffer++;
+        if (pBuffer)
+        {
+            n = (NumByteToRead > W25Q_SPI_CHUNK) ? W25Q_SPI_CHUNK : NumByteToRead;
+            HAL_SPI_Receive(&hspi1, pBuffer, n, W25Q_SPI_TIMEOUT);
+            pBuffer += n;
+        }
+        else
+        {
+            n = (NumByteToRead > sizeof(skip)) ? sizeof(skip) : NumByteToRead;
+            HAL_SPI_Receive(&hspi1, skip, n, W25Q_SPI_TIMEOUT);
+        }
+        NumByteToRead -= n;
     }
+}
+
+// 结束连续读取, 恢复读取前暂停的擦除/写入
+void W25Q_ReadStop(void)
+{
     W25Q_CS_HIGH();
+    if (W25Q_State == W25Q_STATE_SUSPENDED)
+        W25Q_Resume();
+}
+
+// 直接从Flash读取 (不经过读缓存)
+// 读出后由调用者自己保存的数据 (例如汉字缓存) 和只读一次的数据用这个, 不占用读缓存的行
+void W25Q_ReadDirect(uint8_t* pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead)
+{
+    W25Q_ReadStart(ReadAddr);
+    W25Q_ReadContinue(pBuffer, NumByteToRead);
+    W25Q_ReadStop();
+}
+
+// 读取数据 (长度不限, 可以一次读出整幅128x64图片)
+// 短读取经过读缓存 (flash_cache.c), 经常重复读的小段数据不用每次都从Flash读
+void W25Q_Read(uint8_t* pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead)
+{
+    if (FlashCache_Read(pBuffer, ReadAddr, NumByteToRead)) return;
+    W25Q_ReadDirect(pBuffer, ReadAddr, NumByteToRead);
+}
+
+// 测量连续读取的速度 (DWT周期计数器计时), 返回 字节/秒
+static uint32_t W25Q_MeasureReadSpeed(uint8_t *buf)
+{
+    uint32_t start, cycles;
+
+    start = DWT->CYCCNT;
+    W25Q_ReadStart(W25Q_TEST_ADDR);
+    for (uint16_t i = 0; i < W25Q_BENCH_BYTES / W25Q_BENCH_CHUNK; i++)
+        W25Q_ReadContinue(buf, W25Q_BENCH_CHUNK);
+    W25Q_ReadStop();
+    cycles = DWT->CYCCNT - start;
+
+    if (cycles == 0) return 0;
+    return (uint32_t)((uint64_t)W25Q_BENCH_BYTES * SystemCoreClock / cycles);
+}
+
+// 数据是否全部是同一个值 (空白芯片全为0xFF)
+static uint8_t W25Q_IsUniform(const uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 1; i < len; i++)
+        if (buf[i] != buf[0]) return 0;
+    return 1;
+}
+
+// 读取自检: 先用可靠的慢速模式 (9MHz, Read Data 0x03) 读出芯片ID和字库头部作为参照,
+// 再切换到快速模式 (SPI1分频4即18MHz, Fast Read 0x0B + 1个空字节) 读出同样的内容比较,
+// 不一致则退回慢速模式.
+// 参照数据全为同一个值时 (没有烧录字库的空白芯片全为0xFF), 快速读取卡在0xFF也会"一致",
+// 这时无法判断, 保持慢速模式.
+// 返回 W25Q_TEST_FAST:使用快速模式 W25Q_TEST_SLOW:快速读取出错 W25Q_TEST_UNKNOWN:没有可用的参照数据
+// 之后可以用 W25Q_GetSelfTestResult() / W25Q_GetReadSpeed() 查看结果和测得的读取速度
+uint8_t W25Q_SelfTest(void)
+{
+    uint8_t ref_id[3], id[3];
+    uint8_t ref[W25Q_TEST_BYTES], buf[W25Q_TEST_BYTES];
+    uint8_t result;
+
+    // 1. 慢速参照
+    W25Q_SetPrescaler(SPI_BAUDRATEPRESCALER_8);
+    W25Q_ReadCmd = W25X_ReadData;
+    W25Q_ReadDummy = 0;
+    W25Q_Read_ID(ref_id);
+    W25Q_ReadDirect(ref, W25Q_TEST_ADDR, W25Q_TEST_BYTES);
+
+    // 没有芯片或接线有问题时ID为全0或全FF, 保持慢速模式
+    if (ref_id[0] == 0x00 || ref_id[0] == 0xFF)
+        result = W25Q_TEST_SLOW;
+    else if (W25Q_IsUniform(ref, W25Q_TEST_BYTES))
+        result = W25Q_TEST_UNKNOWN;
+    else
+    {
+        // 2. 快速模式读出同样的内容
+        W25Q_SetPrescaler(SPI_BAUDRATEPRESCALER_4);
+        W25Q_ReadCmd = W25X_FastReadData;
+        W25Q_ReadDummy = 1;
+        W25Q_Read_ID(id);
+        W25Q_ReadDirect(buf, W25Q_TEST_ADDR, W25Q_TEST_BYTES);
+        result = (memcmp(id, ref_id, 3) == 0 && memcmp(buf, ref, W25Q_TEST_BYTES) == 0) ? W25Q_TEST_FAST
+                                                                                       : W25Q_TEST_SLOW;
+    }
+
+    // 3. 失败或无法判断时退回慢速模式
+    if (result != W25Q_TEST_FAST)
+    {
+        W25Q_SetPrescaler(SPI_BAUDRATEPRESCALER_8);
+        W25Q_ReadCmd = W25X_ReadData;
+        W25Q_ReadDummy = 0;
+    }
+
+    W25Q_TestResult = result;
+    W25Q_ReadSpeed = W25Q_MeasureReadSpeed(buf);
+    return result;
+}
+
+// 自检结果 W25Q_TEST_FAST / W25Q_TEST_SLOW / W25Q_TEST_UNKNOWN
+uint8_t W25Q_GetSelfTestResult(void)
+{
+    return W25Q_TestResult;
+}
+
+// 当前是否使用快速读取
+uint8_t W25Q_IsFastRead(void)
+{
+    return W25Q_ReadCmd == W25X_FastReadData;
+}
+
+// 自检时测得的读取速度 (字节/秒)
+uint32_t W25Q_GetReadSpeed(void)
+{
+    return W25Q_ReadSpeed;
 }
\ No newline at end of file
@@ -1,24 +1,50 @@
 #ifndef __W25QXX_H
 #define __W25QXX_H
 
-#include "main.h" // HAL
-#include "spi.h"  // <---  spi.h 밴һ޺
+#include "main.h" // 包含HAL库
+#include "spi.h"  // <--- 必须有这个，且 spi.h 必须按第一步修好
 
-// W25Q128 ָ
+// W25Q128 指令集
 #define W25X_WriteEnable		0x06 
 #define W25X_ReadStatusReg1		0x05 
 #define W25X_ReadData			0x03 
+#define W25X_FastReadData		0x0B 
 #define W25X_PageProgram		0x02 
 #define W25X_SectorErase		0x20 
 #define W25X_JedecDeviceID		0x9F 
+#define W25X_Suspend			0x75 
+#define W25X_Resume				0x7A 
 
-// 
+// 读取自检结果 (W25Q_SelfTest)
+#define W25Q_TEST_SLOW    0 // 快速读取出错, 使用慢速模式
+#define W25Q_TEST_FAST    1 // 快速读取正常, 使用快速模式
+#define W25Q_TEST_UNKNOWN 2 // 没有可用的参照数据 (空白芯片), 无法判断, 使用慢速模式
+
+// 函数声明
 void W25Q_Init(void);
 void W25Q_Read_ID(uint8_t *ID);
-void W25Q_Read(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead);
+void W25Q_Read(uint8_t* pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead);
+void W25Q_ReadDirect(uint8_t* pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead);
+void W25Q_ReadStart(uint32_t ReadAddr);
+void W25Q_ReadContinue(uint8_t* pBuffer, uint32_t NumByteToRead);
+void W25Q_ReadStop(void);
 void W25Q_Write(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
 void W25Q_Erase_Sector(uint32_t Dst_Addr);
 void W25Q_Erase_Chip(void);
+void W25Q_Write_Page(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
+void W25Q_Write_NoCheck(uint8_t* pBuffer, uint32_t WriteAddr, uint32_t NumByteToWrite);
+
+// 非阻塞擦除/写入: Start 发出命令后立即返回, 用 W25Q_Poll 查询是否完成
+// 期间的读取会自动暂停擦除/写入, 读取结束 (W25Q_ReadStop) 时恢复;
+// 读正在擦除/写入的区域时先等它完成再读
+void W25Q_Erase_Sector_Start(uint32_t Dst_Addr);
+void W25Q_Write_Page_Start(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
+uint8_t W25Q_Poll(void);
+void W25Q_Sync(void);
+uint8_t W25Q_SelfTest(void);
+uint8_t W25Q_GetSelfTestResult(void);
+uint8_t W25Q_IsFastRead(void);
+uint32_t W25Q_GetReadSpeed(void);
 
 
 #endif
\ No newline at end of file
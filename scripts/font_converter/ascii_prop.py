@@ -0,0 +1,201 @@
+import re
+import sys
+
+from glyph_pack import pack_glyph
+
+# ================= 配置区域 =================
+# 1. 等宽字体的取模数据 (波特律动LED取模助手生成, 列行式, 从 ' ' 到 '~' 共95个字符)
+SOURCE_FILE = 'ascii_24x12.c'
+ARRAY_NAME = 'ascii_24x12'
+FONT_H = 24
+FONT_W = 12
+
+# 2. 输出: 替换目标文件中 "// ascii_prop.py: <FONT_NAME> begin" 与 "... end" 之间的内容
+TARGET_FILE = '../../Modules/font.c'
+FONT_NAME = 'afont24x12'
+
+# 3. 字距
+LEFT_BEARING = 1         # 字模左边留白
+RIGHT_BEARING = 1        # 字模右边留白
+SPACE_ADVANCE = FONT_W // 2  # 空格宽度
+TABULAR = '0123456789'   # 等宽数字: 这些字符的前进量相同, 时钟、计数等数字变化时文字不会左右跳动
+
+# 4. 字距调整 (kerning): 两个字符之间最窄处比正常间距宽出 KERN_MIN 像素以上时, 把后一个字符左移
+# 每对占3字节Flash, 只对最常见的宽松组合调整; KERN_CHARS 为空时不生成字距调整表
+KERN_CHARS = 'AFLPTVWY.,'
+KERN_MIN = 4
+KERN_MAX = FONT_H // 8   # 最多左移的像素
+
+# 5. 压缩字模 (格式见 glyph_pack.py), 字符表中的位置指向压缩后的数据
+COMPRESS = True
+# ===========================================
+
+# 说明:
+# 等宽字体每个字符都占 FONT_W 列, 窄字符 (i, l, 1, 标点) 两边是大片空白, 浪费屏幕宽度和Flash.
+# 本脚本去掉每个字模左右的空白列, 生成:
+#   <ARRAY>_data[]   紧凑的字模数据, 每个字按页排列, 每页只保存有笔画的列 (COMPRESS时再压缩掉0字节)
+#   <ARRAY>_glyphs[] 每个字符的 {字模位置, 字模宽度, 左右留白}, 每个字符4字节, 左右留白各占4位, 前进量 = 左留白 + 宽度 + 右留白
+#   <ARRAY>_kern[]   字距调整表, 按 (前一个字符, 后一个字符) 升序排列, OLED中用二分查找
+# 以及使用它们的 ASCIIFont 定义. OLED_PrintASCIIString 检测到 glyphs 不为NULL时按比例字体绘制.
+
+ROW_PATTERN = re.compile(r'^\s*(/\*.*?\*/)?\s*\{([^}]*)\}\s*,?\s*(//.*|/\*.*?\*/)?\s*$')
+COMMENT_PATTERN = re.compile(r'^\s*(/\*.*?\*/|//.*)?\s*$')
+
+
+def load_glyphs(path, name, pages, w):
+    """读取等宽字体: 返回95个字模, 每个字模是 pages 个长度为 w 的列表"""
+    with open(path, 'r', encoding='utf-8') as f:
+        text = f.read()
+    start = re.search(r'\b' + re.escape(name) + r'\s*\[\s*\]\s*\[\s*\d+\s*\]\s*=\s*\{\s*\n', text)
+    if not start:
+        raise ValueError(f'在 {path} 中找不到数组 {name}')
+    end = text.index('};', start.end())
+
+    glyphs = []
+    for line in text[start.end():end].split('\n'):
+        m = ROW_PATTERN.match(line)
+        if not m:
+            if COMMENT_PATTERN.match(line):
+                continue  # 空行或只有注释的行
+            raise ValueError(f'无法解析这一行: {line.strip()[:60]}')
+        values = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]{1,2})', m.group(2))]
+        if len(values) != pages * w:
+            raise ValueError(f'第 {len(glyphs)} 个字模长度为 {len(values)}, 应为 {pages * w}')
+        glyphs.append([values[p * w:(p + 1) * w] for p in range(pages)])
+    if len(glyphs) != 95:
+        raise ValueError(f'字模个数为 {len(glyphs)}, 应为 95')
+    return glyphs
+
+
+def column_bits(glyph, col):
+    """一列的点阵 (第r位为第r行)"""
+    bits = 0
+    for p, page in enumerate(glyph):
+        bits |= page[col] << (p * 8)
+    return bits
+
+
+def profile(glyph, cols, rows, rightmost):
+    """每一行最左(或最右)有笔画的列, 没有笔画的行为None"""
+    result = []
+    for r in range(rows):
+        found = [c for c in cols if column_bits(glyph, c) >> r & 1]
+        result.append((max(found) if rightmost else min(found)) if found else None)
+    return result
+
+
+def main():
+    pages = (FONT_H + 7) // 8
+    glyphs = load_glyphs(SOURCE_FILE, ARRAY_NAME, pages, FONT_W)
+
+    # 1. 找出每个字的笔画范围
+    info = []  # (首列, 宽度)
+    for glyph in glyphs:
+        ink = [c for c in range(FONT_W) if column_bits(glyph, c)]
+        info.append((ink[0], ink[-1] - ink[0] + 1) if ink else (0, 0))
+
+    tab_w = max(info[ord(ch) - 32][1] for ch in TABULAR) if TABULAR else 0
+
+    # 2. 留白与前进量
+    metrics = []  # (首列, 宽度, 左边留白, 前进量)
+    for i, (first, w) in enumerate(info):
+        ch = chr(i + 32)
+        if w == 0:
+            metrics.append((0, 0, 0, SPACE_ADVANCE))
+        elif ch in TABULAR:
+            advance = LEFT_BEARING + tab_w + RIGHT_BEARING
+            metrics.append((first, w, LEFT_BEARING + (tab_w - w) // 2, advance))
+        else:
+            metrics.append((first, w, LEFT_BEARING, LEFT_BEARING + w + RIGHT_BEARING))
+
+    # 3. 字距调整: 比较前一个字的右轮廓与后一个字的左轮廓 (上下相邻的行也算, 避免斜向粘连)
+    right_prof = []
+    left_prof = []
+    for glyph, (first, w, _, _) in zip(glyphs, metrics):
+        cols = range(first, first + w)
+        right_prof.append([None if c is None else c - first for c in profile(glyph, cols, FONT_H, True)])
+        left_prof.append([None if c is None else c - first for c in profile(glyph, cols, FONT_H, False)])
+
+    kerns = []
+    normal_gap = LEFT_BEARING + RIGHT_BEARING
+    for a in KERN_CHARS:
+        ia = ord(a) - 32
+        _, wa, la, adva = metrics[ia]
+        for b in KERN_CHARS:
+            ib = ord(b) - 32
+            _, wb, lb, _ = metrics[ib]
+            if wa == 0 or wb == 0:
+                continue
+            gap = None
+            for r in range(FONT_H):
+                if right_prof[ia][r] is None:
+                    continue
+                for rr in (r - 1, r, r + 1):
+                    if 0 <= rr < FONT_H and left_prof[ib][rr] is not None:
+                        g = (adva + lb + left_prof[ib][rr]) - (la + right_prof[ia][r]) - 1
+                        gap = g if gap is None else min(gap, g)
+            if gap is None:
+                continue  # 两个字上下错开, 没有相邻的笔画 (例如 '.' 与 'T' 的上半部分) 不调整
+            extra = gap - normal_gap
+            if extra >= KERN_MIN:
+                kerns.append((a, b, -min(extra - KERN_MIN + 1, KERN_MAX)))
+    kerns.sort(key=lambda k: (ord(k[0]), ord(k[1])))
+
+    # 4. 生成代码
+    data_lines = []
+    glyph_lines = []
+    offset = 0
+    for i, (glyph, (first, w, left, advance)) in enumerate(zip(glyphs, metrics)):
+        ch = chr(i + 32)
+        values = [glyph[p][c] for p in range(pages) for c in range(first, first + w)]
+        if COMPRESS and values:
+            values = pack_glyph(values)
+        if values:
+            data_lines.append('    ' + ', '.join(f'0x{v:02X}' for v in values) + f', /*"{ch}",{i}*/')
+        right = advance - left - w
+        if not (0 <= left <= 15 and 0 <= right <= 15):
+            raise ValueError(f'"{ch}" 的留白超出4位: 左 {left} 右 {right}')
+        glyph_lines.append(f'    {{{offset}, {w}, 0x{left:X}{right:X}}}, /*"{ch}"*/')
+        offset += len(values)
+
+    kern_lines = [f"    {{'{a}', '{b}', {adj}}}," for a, b, adj in kerns]
+    mono = 95 * pages * FONT_W
+    size = offset + 95 * 4 + len(kerns) * 3
+
+    out = [f'// ascii_prop.py: {FONT_NAME} begin',
+           f'// 比例字体 由 scripts/font_converter/ascii_prop.py 从 {SOURCE_FILE} 生成, 请勿手工修改',
+           f'const unsigned char {ARRAY_NAME}_data[] = {{']
+    out += data_lines
+    out += ['};', '', f'const ASCIIGlyph {ARRAY_NAME}_glyphs[] = {{']
+    out += glyph_lines
+    out += ['};', '']
+    if kerns:
+        out += [f'const ASCIIKern {ARRAY_NAME}_kern[] = {{'] + kern_lines + ['};', '']
+        kern_ref = f'{ARRAY_NAME}_kern, {len(kerns)}'
+    else:
+        kern_ref = 'NULL, 0'
+    max_advance = max(m[3] for m in metrics)
+    out += [f'const ASCIIFont {FONT_NAME} = {{{FONT_H}, {max_advance}, (unsigned char *){ARRAY_NAME}_data, '
+            f'{ARRAY_NAME}_glyphs, {kern_ref}, {int(COMPRESS)}, NULL}};',
+            f'// ascii_prop.py: {FONT_NAME} end']
+
+    with open(TARGET_FILE, 'r', encoding='utf-8') as f:
+        text = f.read()
+    begin = text.find(f'// ascii_prop.py: {FONT_NAME} begin')
+    end_mark = f'// ascii_prop.py: {FONT_NAME} end'
+    end = text.find(end_mark)
+    if begin < 0 or end < 0:
+        print(f"❌ 在 {TARGET_FILE} 中找不到 {FONT_NAME} 的 begin/end 标记")
+        return 1
+    text = text[:begin] + '\n'.join(out) + text[end + len(end_mark):]
+    with open(TARGET_FILE, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+    print(f"✅ {FONT_NAME}: {len(kerns)} 个字距调整")
+    print(f"   Flash: 等宽 {mono} 字节 -> 比例{'(压缩)' if COMPRESS else ''} {size} 字节 "
+          f"(字模 {offset} + 字符表 {95 * 4} + 字距表 {len(kerns) * 3})")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,80 @@
+import re
+import sys
+
+# ================= 配置区域 =================
+# 1. 字库所在的C文件 (波特律动LED取模助手生成的字库粘贴在这里)
+SOURCE_FILE = '../../Modules/font.c'
+
+# 2. 要排序的字库数组名 (例如 const uint8_t zh16x16[][36] = {...};)
+ARRAY_NAME = 'zh16x16'
+# ===========================================
+
+# 说明:
+# 字库每个字模的前4字节是字符的utf8编码(不足4字节补0), 后面是点阵数据.
+# 本脚本把字库按这4字节升序重新排列, 并检查有没有重复的字.
+# 排序后在Font结构体的最后一项填1 (sorted = 1), OLED_PrintString 就会用二分查找.
+# 4字节按字节比较的顺序和Unicode码点的顺序相同, 所以单片机上比较时不需要解码utf8.
+
+ROW_PATTERN = re.compile(r'^\s*(/\*.*?\*/)?\s*\{([^}]*)\}\s*,?\s*(//.*)?$')
+
+
+def parse_row(line):
+    """解析一行字模: 返回 (注释, 字节列表), 不是字模行时返回None"""
+    m = ROW_PATTERN.match(line)
+    if not m:
+        return None
+    values = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]{1,2})', m.group(2))]
+    return (m.group(1) or m.group(3) or '', values)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else SOURCE_FILE
+    name = sys.argv[2] if len(sys.argv) > 2 else ARRAY_NAME
+
+    with open(path, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    # 1. 找到数组
+    start = re.search(r'\b' + re.escape(name) + r'\s*\[\s*\]\s*\[\s*\d+\s*\]\s*=\s*\{\s*\n', text)
+    if not start:
+        print(f"❌ 在 {path} 中找不到数组 {name}")
+        return 1
+    end = text.index('};', start.end())
+    body = text[start.end():end]
+
+    # 2. 解析每个字模
+    rows = []
+    for line in body.split('\n'):
+        if not line.strip():
+            continue
+        row = parse_row(line)
+        if row is None:
+            print(f"❌ 无法解析这一行: {line.strip()[:60]}")
+            return 1
+        rows.append(row)
+
+    # 3. 按utf8编码排序并查重
+    rows.sort(key=lambda r: bytes(r[1][:4]))
+    for a, b in zip(rows, rows[1:]):
+        if a[1][:4] == b[1][:4]:
+            print(f"❌ 重复的字: {bytes(a[1][:4]).rstrip(bytes(1)).decode('utf-8', 'replace')}")
+            return 1
+
+    # 4. 写回 (注释中的序号重新编号)
+    lines = []
+    for i, (comment, values) in enumerate(rows):
+        char = bytes(values[:4]).rstrip(bytes(1)).decode('utf-8', 'replace')
+        hex_str = ','.join(f'0x{v:02x}' for v in values)
+        sep = ',' if i < len(rows) - 1 else ''
+        lines.append(f'/* {i} {char} */ {{{hex_str},}}{sep}')
+    text = text[:start.end()] + '\n'.join(lines) + '\n' + text[end:]
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+    print(f"✅ {name}: {len(rows)} 个字已按utf8编码排序")
+    print(f"   请确认 Font 定义的最后一项为 1, 例如: {{16, 16, (const uint8_t *){name}, {len(rows)}, &afont16x8, 1}}")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
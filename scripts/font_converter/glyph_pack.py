@@ -0,0 +1,140 @@
+import re
+import sys
+
+# ================= 配置区域 =================
+# 要压缩的等宽ASCII字体 (波特律动LED取模助手生成, 列行式, 从 ' ' 到 '~' 共95个字符)
+# (取模数据文件, 数组名, 字高, 字宽, 字体名)
+# 生成的代码替换 TARGET_FILE 中 "// glyph_pack.py: <字体名> begin" 与 "... end" 之间的内容
+FONTS = [
+    ('ascii_12x6.c', 'ascii_12x6', 12, 6, 'afont12x6'),
+    ('ascii_16x8.c', 'ascii_16x8', 16, 8, 'afont16x8'),
+]
+TARGET_FILE = '../../Modules/font.c'
+# ===========================================
+
+# 说明:
+# 字模中约1/3的字节是0 (字的上下左右留白). 压缩格式 (每个字模):
+#   非零字节掩码  (字模字节数 + 7) / 8 字节, 第i位(第i/8字节的第i%8位)为1表示第i个字节不是0
+#   非零字节      按顺序排列
+# OLED中边读掩码边把非零字节写入显存 (OLED_BlitPacked), 不需要先解压到缓冲区, 0字节直接跳过.
+# 等宽字体的字模长度不固定, 所以另外生成一个索引: 每 INDEX_STEP 个字记录第一个字的位置,
+# 取字时从索引处开始, 按掩码中1的个数跳过前面最多 INDEX_STEP - 1 个字.
+# 比例字体由 ascii_prop.py 生成 (COMPRESS = True 时也用这个格式), 字符表中直接记录每个字的位置.
+#
+# 用法: python glyph_pack.py           压缩 FONTS 中的字体并写入 TARGET_FILE
+#       python glyph_pack.py --report  只打印压缩前后的大小, 不修改文件
+
+INDEX_STEP = 4  # 与 Modules/font.h 中的 ASCII_PACK_INDEX_STEP 相同
+
+ROW_PATTERN = re.compile(r'^\s*(/\*.*?\*/)?\s*\{([^}]*)\}\s*,?\s*(//.*|/\*.*?\*/)?\s*$')
+COMMENT_PATTERN = re.compile(r'^\s*(/\*.*?\*/|//.*)?\s*$')
+
+
+def load_glyphs(path, name, size):
+    """读取取模数组: 返回字模列表, 每个字模是长度为 size 的字节列表"""
+    with open(path, 'r', encoding='utf-8') as f:
+        text = f.read()
+    start = re.search(r'\b' + re.escape(name) + r'\s*\[\s*\]\s*\[\s*\d+\s*\]\s*=\s*\{\s*\n', text)
+    if not start:
+        raise ValueError(f'在 {path} 中找不到数组 {name}')
+    end = text.index('};', start.end())
+
+    glyphs = []
+    for line in text[start.end():end].split('\n'):
+        m = ROW_PATTERN.match(line)
+        if not m:
+            if COMMENT_PATTERN.match(line):
+                continue  # 空行或只有注释的行
+            raise ValueError(f'无法解析这一行: {line.strip()[:60]}')
+        values = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]{1,2})', m.group(2))]
+        if len(values) != size:
+            raise ValueError(f'第 {len(glyphs)} 个字模长度为 {len(values)}, 应为 {size}')
+        glyphs.append(values)
+    return glyphs
+
+
+def pack_glyph(values):
+    """压缩一个字模: 返回 非零字节掩码 + 非零字节"""
+    mask = [0] * ((len(values) + 7) // 8)
+    data = []
+    for i, v in enumerate(values):
+        if v:
+            mask[i // 8] |= 1 << (i % 8)
+            data.append(v)
+    return mask + data
+
+
+def unpack_glyph(packed, size):
+    """解压 (用于自检)"""
+    mask_len = (size + 7) // 8
+    data = iter(packed[mask_len:])
+    return [next(data) if packed[i // 8] >> (i % 8) & 1 else 0 for i in range(size)]
+
+
+def char_name(i):
+    return chr(i + 32)
+
+
+def generate(source, name, h, w, font_name):
+    """返回 (生成的代码行, 压缩前字节数, 压缩后字节数)"""
+    size = (h + 7) // 8 * w
+    glyphs = load_glyphs(source, name, size)
+    if len(glyphs) != 95:
+        raise ValueError(f'{name}: 字模个数为 {len(glyphs)}, 应为 95')
+
+    lines = [f'// glyph_pack.py: {font_name} begin',
+             f'// 压缩字体 由 scripts/font_converter/glyph_pack.py 从 {source} 生成, 请勿手工修改',
+             f'const unsigned char {name}_packed[] = {{']
+    index = []
+    offset = 0
+    for i, values in enumerate(glyphs):
+        packed = pack_glyph(values)
+        assert unpack_glyph(packed, size) == values
+        if i % INDEX_STEP == 0:
+            index.append(offset)
+        lines.append('    ' + ', '.join(f'0x{v:02X}' for v in packed) + f', /*"{char_name(i)}",{i}*/')
+        offset += len(packed)
+    lines += ['};', '',
+              f'const uint16_t {name}_index[] = {{{", ".join(str(v) for v in index)}}};', '',
+              f'const ASCIIFont {font_name} = {{{h}, {w}, (unsigned char *){name}_packed, NULL, NULL, 0, 1, {name}_index}};',
+              f'// glyph_pack.py: {font_name} end']
+    return lines, 95 * size, offset + 2 * len(index)
+
+
+def replace_block(text, font_name, lines):
+    begin = text.find(f'// glyph_pack.py: {font_name} begin')
+    end_mark = f'// glyph_pack.py: {font_name} end'
+    end = text.find(end_mark)
+    if begin < 0 or end < 0:
+        raise ValueError(f'在 {TARGET_FILE} 中找不到 {font_name} 的 begin/end 标记')
+    return text[:begin] + '\n'.join(lines) + text[end + len(end_mark):]
+
+
+def main():
+    report_only = len(sys.argv) > 1 and sys.argv[1] == '--report'
+
+    with open(TARGET_FILE, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    total_raw = total_packed = 0
+    for source, name, h, w, font_name in FONTS:
+        try:
+            lines, raw, packed = generate(source, name, h, w, font_name)
+            if not report_only:
+                text = replace_block(text, font_name, lines)
+        except ValueError as e:
+            print(f"❌ {e}")
+            return 1
+        total_raw += raw
+        total_packed += packed
+        print(f"   {font_name}: {raw} -> {packed} 字节 ({packed * 100 // raw}%)")
+
+    if not report_only:
+        with open(TARGET_FILE, 'w', encoding='utf-8') as f:
+            f.write(text)
+    print(f"✅ 共 {total_raw} -> {total_packed} 字节, 节省 {total_raw - total_packed} 字节")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,198 @@
+/**
+ * @file bench_font.c
+ * @brief 压缩字模的主机(PC)测试: 大小报告、逐像素比较、绘制速度
+ * @note 未压缩的对照字体:
+ *       - 12x6 / 16x8 直接编译 scripts/font_converter 中的取模原始数据
+ *       - 24x12 比例字体在运行时把压缩字模解压成一份未压缩的副本 (字符表相同)
+ *       两种字体在同一位置、同一颜色下画出的显存必须逐字节相同
+ */
+#include "oled.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../font_converter/ascii_12x6.c"
+#include "../font_converter/ascii_16x8.c"
+
+#define ROUNDS 20000
+
+static const ASCIIFont raw12x6 = {12, 6, (unsigned char *)ascii_12x6};
+static const ASCIIFont raw16x8 = {16, 8, (unsigned char *)ascii_16x8};
+
+static uint8_t raw24_data[4096];
+static ASCIIGlyph raw24_glyphs[95];
+static ASCIIFont raw24x12;
+
+static uint8_t buf_a[OLED_CANVAS_SIZE(128, 64)];
+static uint8_t buf_b[OLED_CANVAS_SIZE(128, 64)];
+static Canvas canvas_a = {128, 64, buf_a};
+static Canvas canvas_b = {128, 64, buf_b};
+
+static char all_chars[96];
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief 一个压缩字模的长度
+ */
+static uint16_t packed_len(const uint8_t *p, uint16_t bytes)
+{
+  uint16_t n = (bytes + 7) / 8;
+  for (uint16_t j = 0; j < (bytes + 7) / 8; j++)
+    n += __builtin_popcount(p[j]);
+  return n;
+}
+
+static void unpack(const uint8_t *p, uint8_t *out, uint16_t bytes)
+{
+  const uint8_t *data = p + (bytes + 7) / 8;
+  for (uint16_t i = 0; i < bytes; i++)
+    out[i] = (p[i >> 3] >> (i & 7) & 1) ? *data++ : 0;
+}
+
+/**
+ * @brief 把压缩的比例字体解压成未压缩的副本
+ */
+static void build_raw24(void)
+{
+  const ASCIIFont *src = &afont24x12;
+  uint8_t pages = (src->h + 7) / 8;
+  uint16_t offset = 0;
+
+  for (uint8_t i = 0; i < 95; i++)
+  {
+    raw24_glyphs[i] = src->glyphs[i];
+    raw24_glyphs[i].offset = offset;
+    if (src->glyphs[i].w)
+      unpack(src->chars + src->glyphs[i].offset, raw24_data + offset, pages * src->glyphs[i].w);
+    offset += pages * src->glyphs[i].w;
+  }
+  raw24x12 = *src;
+  raw24x12.chars = raw24_data;
+  raw24x12.glyphs = raw24_glyphs;
+  raw24x12.packed = 0;
+}
+
+/**
+ * @brief 字体占用的Flash (字模 + 字符表/索引)
+ */
+static uint32_t font_size(const ASCIIFont *font)
+{
+  uint8_t pages = (font->h + 7) / 8;
+  uint32_t size = 0;
+
+  for (uint8_t i = 0; i < 95; i++)
+  {
+    uint16_t bytes = pages * (font->glyphs ? font->glyphs[i].w : font->w);
+    if (!font->packed)
+      size += bytes;
+    else if (font->glyphs)
+      size += bytes ? packed_len(font->chars + font->glyphs[i].offset, bytes) : 0;
+    else
+      size += packed_len(font->chars + size, bytes); // 等宽字体的字模首尾相接
+  }
+  if (font->glyphs)
+    size += 95 * sizeof(ASCIIGlyph) + font->kernCount * sizeof(ASCIIKern);
+  if (font->packed && !font->glyphs)
+    size += (95 + ASCII_PACK_INDEX_STEP - 1) / ASCII_PACK_INDEX_STEP * sizeof(uint16_t);
+  return size;
+}
+
+static void draw_text(const ASCIIFont *font, int16_t y0, OLED_ColorMode color)
+{
+  uint8_t per_line = 128 / font->w;
+  char line[40];
+
+  for (uint8_t start = 0, row = 0; start < 95; start += per_line, row++)
+  {
+    uint8_t n = (95 - start < per_line) ? 95 - start : per_line;
+    memcpy(line, all_chars + start, n);
+    line[n] = '\0';
+    OLED_PrintASCIIString(-3, y0 + row * font->h, line, font, color);
+  }
+}
+
+static int compare(const char *name, const ASCIIFont *raw, const ASCIIFont *packed)
+{
+  static const int16_t offsets[] = {0, 3, -5, 7};
+  int bad = 0;
+
+  for (uint8_t k = 0; k < sizeof(offsets) / sizeof(offsets[0]); k++)
+  {
+    for (uint8_t color = 0; color < 2; color++)
+    {
+      // 先铺一层图案, 检查字模以外的像素没有被改动
+      memset(buf_a, 0x5A, sizeof(buf_a));
+      memset(buf_b, 0x5A, sizeof(buf_b));
+      OLED_SetTarget(&canvas_a);
+      draw_text(raw, offsets[k], color);
+      OLED_SetTarget(&canvas_b);
+      draw_text(packed, offsets[k], color);
+      OLED_SetTarget(NULL);
+      if (memcmp(buf_a, buf_b, sizeof(buf_a)))
+        bad++;
+    }
+  }
+  printf("%-10s %s\n", name, bad ? "MISMATCH" : "ok");
+  return bad;
+}
+
+static double bench(const ASCIIFont *font)
+{
+  double t0, t1;
+
+  OLED_SetTarget(&canvas_a);
+  t0 = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++)
+    draw_text(font, 0, r & 1);
+  t1 = now_ns();
+  OLED_SetTarget(NULL);
+  return (t1 - t0) / ROUNDS / 95;
+}
+
+int main(void)
+{
+  struct {
+    const char *name;
+    const ASCIIFont *raw;
+    const ASCIIFont *packed;
+  } fonts[] = {
+      {"afont12x6", &raw12x6, &afont12x6},
+      {"afont16x8", &raw16x8, &afont16x8},
+      {"afont24x12", &raw24x12, &afont24x12},
+  };
+  uint32_t total_raw = 0, total_packed = 0;
+  int bad = 0;
+
+  for (uint8_t i = 0; i < 95; i++)
+    all_chars[i] = ' ' + i;
+  build_raw24();
+
+  printf("== 逐像素比较 (未压缩 vs 压缩, 4种纵向偏移, 正常/反色) ==\n");
+  for (uint8_t i = 0; i < 3; i++)
+    bad += compare(fonts[i].name, fonts[i].raw, fonts[i].packed);
+
+  printf("\n== Flash占用 (字节) ==\n");
+  printf("%-10s %8s %8s %6s\n", "font", "raw", "packed", "ratio");
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    uint32_t r = font_size(fonts[i].raw), p = font_size(fonts[i].packed);
+    total_raw += r;
+    total_packed += p;
+    printf("%-10s %8u %8u %5u%%\n", fonts[i].name, r, p, p * 100 / r);
+  }
+  printf("%-10s %8u %8u %5u%%\n", "total", total_raw, total_packed, total_packed * 100 / total_raw);
+
+  printf("\n== 绘制速度 (纳秒/字, 95个字符, 正常与反色交替) ==\n");
+  printf("%-10s %8s %8s\n", "font", "raw", "packed");
+  for (uint8_t i = 0; i < 3; i++)
+    printf("%-10s %8.1f %8.1f\n", fonts[i].name, bench(fonts[i].raw), bench(fonts[i].packed));
+
+  return bad != 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file bench_tetris.c
+ * @brief 俄罗斯方块画面的主机(PC)测试: 转置整块写入 vs 逐像素画旋转文字
+ * @note 两个版本都是真正的Applications/game.c (见tetris_unit.c), 只差TETRIS_ROTATE_PER_PIXEL;
+ *       同一局面下画出的屏幕必须逐像素相同, 之后比较一帧DrawTetris()的耗时
+ */
+#include "oled.h"
+#include "oled_port_linux.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define STATES 200
+#define ROUNDS 20000
+#define REPEAT 7 // 两个版本交替各测REPEAT次, 取最小值, 减少其他进程的干扰
+
+void Tetris_SetState(uint32_t seed, uint8_t over);
+void Tetris_Draw(void);
+void px_Tetris_SetState(uint32_t seed, uint8_t over);
+void px_Tetris_Draw(void);
+void DrawString_Rotated(int16_t x, int16_t y, char *str, const ASCIIFont *font);
+void px_DrawString_Rotated(int16_t x, int16_t y, char *str, const ASCIIFont *font);
+
+// game.c用到的按键和菜单接口, 测试中不会调用到
+uint8_t Key_IsSingleClick(uint8_t key_id)
+{
+  (void)key_id;
+  return 0;
+}
+
+void Menu_SwitchToMenu(void)
+{
+}
+
+static uint8_t screen_a[PANEL_ROW][128];
+static uint8_t screen_b[PANEL_ROW][128];
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void grab(uint8_t screen[PANEL_ROW][128])
+{
+  for (uint8_t y = 0; y < PANEL_ROW; y++)
+    for (uint8_t x = 0; x < 128; x++)
+      screen[y][x] = Panel_GetPixel(x, y);
+}
+
+static int compare(void)
+{
+  int bad = 0;
+
+  OLED_SetPort(&OLED_PortLinux);
+  OLED_Init();
+  for (uint32_t s = 0; s < STATES; s++)
+  {
+    uint8_t over = s & 1;
+    Tetris_SetState(s, over);
+    Tetris_Draw(); // 不接面板时DrawTetris()只画不发送, 这里接上面板, 画完即发送
+    grab(screen_a);
+    px_Tetris_SetState(s, over);
+    px_Tetris_Draw();
+    grab(screen_b);
+    if (memcmp(screen_a, screen_b, sizeof(screen_a)))
+      bad++;
+  }
+  OLED_SetPort(NULL);
+  return bad;
+}
+
+static double bench_frame(void (*set)(uint32_t, uint8_t), void (*draw)(void), uint8_t over)
+{
+  double t0;
+
+  set(12345, over);
+  t0 = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++)
+    draw();
+  return (now_ns() - t0) / ROUNDS;
+}
+
+/**
+ * @brief 只画DrawTetris()中的四段旋转文字 (分数按6位数计)
+ */
+static double bench_text(void (*text)(int16_t, int16_t, char *, const ASCIIFont *))
+{
+  double t0;
+
+  t0 = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++)
+  {
+    OLED_NewFrame();
+    text(2, 58, "Score", &afont8x6);
+    text(2, 26, "123456", &afont8x6);
+    text(54, 40, "GAME", &afont8x6);
+    text(64, 40, "OVER", &afont8x6);
+  }
+  return (now_ns() - t0) / ROUNDS;
+}
+
+static double min(double a, double b)
+{
+  return a < b ? a : b;
+}
+
+int main(void)
+{
+  double t[3][2];
+  int bad;
+
+  Panel_Reset();
+  bad = compare();
+  printf("== 逐像素比较 (%u个局面, 游戏中/结束交替) ==\n%s\n", STATES, bad ? "MISMATCH" : "ok");
+
+  for (uint8_t i = 0; i < 3; i++)
+    t[i][0] = t[i][1] = 1e30;
+  for (uint8_t k = 0; k < REPEAT; k++)
+  {
+    for (uint8_t over = 0; over < 2; over++)
+    {
+      t[over][0] = min(t[over][0], bench_frame(Tetris_SetState, Tetris_Draw, over));
+      t[over][1] = min(t[over][1], bench_frame(px_Tetris_SetState, px_Tetris_Draw, over));
+    }
+    t[2][0] = min(t[2][0], bench_text(DrawString_Rotated));
+    t[2][1] = min(t[2][1], bench_text(px_DrawString_Rotated));
+  }
+
+  printf("\n== 耗时 (纳秒, 不含发送) ==\n");
+  printf("%-20s %10s %10s\n", "", "transpose", "per-pixel");
+  printf("%-20s %10.0f %10.0f\n", "frame, playing", t[0][0], t[0][1]);
+  printf("%-20s %10.0f %10.0f\n", "frame, game over", t[1][0], t[1][1]);
+  printf("%-20s %10.0f %10.0f\n", "text only (19 chars)", t[2][0], t[2][1]);
+  return bad != 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file hal_stub.c
+ * @brief 主机(PC)编译oled.c时使用的HAL替身
+ * @note 外部Flash的内容由地址算出(不是真正的字库), 同一地址每次读出相同的数据;
+ *       W25Q_SetImage()设置的一段数据(例如字库头部)覆盖在Flash开头
+ */
+#include "main.h"
+#include "w25qxx.h"
+#include <time.h>
+
+uint32_t W25Q_ReadCount; // 读取次数 (片选拉低一次算一次)
+uint32_t W25Q_ReadBytes; // 读出的字节数 (含跳过的)
+static uint32_t W25Q_Cursor;
+
+static const uint8_t *W25Q_Image;
+static uint32_t W25Q_ImageLen;
+
+void W25Q_SetImage(const void *image, uint32_t len)
+{
+  W25Q_Image = image;
+  W25Q_ImageLen = len;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  (void)Delay;
+}
+
+void W25Q_ReadStart(uint32_t ReadAddr)
+{
+  W25Q_Cursor = ReadAddr;
+  W25Q_ReadCount++;
+}
+
+void W25Q_ReadContinue(uint8_t *pBuffer, uint32_t NumByteToRead)
+{
+  for (uint32_t i = 0; i < NumByteToRead; i++, W25Q_Cursor++)
+  {
+    uint8_t v;
+    if (W25Q_Cursor < W25Q_ImageLen)
+      v = W25Q_Image[W25Q_Cursor];
+    else
+      v = (uint8_t)((W25Q_Cursor * 2654435761u) >> 24);
+    if (pBuffer)
+      pBuffer[i] = v;
+  }
+  W25Q_ReadBytes += NumByteToRead;
+}
+
+void W25Q_ReadStop(void)
+{
+}
+
+void W25Q_ReadDirect(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead)
+{
+  W25Q_ReadStart(ReadAddr);
+  W25Q_ReadContinue(pBuffer, NumByteToRead);
+  W25Q_ReadStop();
+}
+
+void W25Q_Read(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead)
+{
+  W25Q_ReadDirect(pBuffer, ReadAddr, NumByteToRead);
+}
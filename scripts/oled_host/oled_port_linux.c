@@ -0,0 +1,169 @@
+/**
+ * @file oled_port_linux.c
+ * @brief OLED底层通信接口的PC实现: 虚拟SH1106面板
+ * @note 按SH1106的规则解释收到的指令流和显存数据, 得到面板上真正显示的内容,
+ *       同时统计I2C传输次数和线上字节数
+ * @note 后台发送直接完成并立即回调OLED_Port_TxDone()
+ */
+#include "oled_port_linux.h"
+#include <stdio.h>
+#include <string.h>
+
+Panel panel;
+
+void Panel_Reset(void)
+{
+  memset(&panel, 0, sizeof(panel));
+  panel.contrast = 0x80;
+}
+
+void Panel_ResetCounters(void)
+{
+  panel.transactions = 0;
+  panel.busBytes = 0;
+}
+
+/**
+ * @brief 执行一个指令字节
+ */
+static void Panel_Command(uint8_t cmd)
+{
+  if (panel.pending)
+  {
+    // 双字节指令的参数
+    if (panel.pending == 0x81)
+      panel.contrast = cmd;
+    panel.pending = 0;
+    return;
+  }
+  if (cmd <= 0x0F)
+    panel.column = (panel.column & 0xF0) | cmd; // 列地址低4位
+  else if (cmd <= 0x1F)
+    panel.column = (panel.column & 0x0F) | ((cmd & 0x0F) << 4); // 列地址高4位
+  else if (cmd >= 0x30 && cmd <= 0x33)
+    ; // 泵电压
+  else if (cmd >= 0x40 && cmd <= 0x7F)
+    panel.startLine = cmd & 0x3F;
+  else if (cmd == 0xA0 || cmd == 0xA1)
+    panel.segRemap = cmd & 1;
+  else if (cmd == 0xA4 || cmd == 0xA5)
+    ; // 全屏点亮
+  else if (cmd == 0xA6 || cmd == 0xA7)
+    panel.inverse = cmd & 1;
+  else if (cmd == 0xAE || cmd == 0xAF)
+    panel.displayOn = cmd & 1;
+  else if (cmd >= 0xB0 && cmd <= 0xB7)
+    panel.page = cmd & 0x07;
+  else if (cmd == 0xC0 || cmd == 0xC8)
+    panel.comReverse = (cmd == 0xC8);
+  else if (cmd == 0x81 || cmd == 0xA8 || cmd == 0xAD || cmd == 0xD3 ||
+           cmd == 0xD5 || cmd == 0xD9 || cmd == 0xDA || cmd == 0xDB)
+    panel.pending = cmd;
+  else if (cmd == 0xE3)
+    ; // NOP
+  else
+    panel.unknownCmds++; // 例如SSD1306的0x8D电荷泵指令, SH1106不认识
+}
+
+static uint8_t Panel_Write(uint8_t ctrl, const uint8_t *data, uint16_t len)
+{
+  panel.transactions++;
+  panel.busBytes += 2 + len;
+  for (uint16_t i = 0; i < len; i++)
+  {
+    if (ctrl == 0x40)
+    {
+      if (panel.column < PANEL_COLUMN)
+        panel.ram[panel.page][panel.column] = data[i];
+      if (panel.column < PANEL_COLUMN - 1)
+        panel.column++; // 列地址自动加1, 到最后一列后停住
+    }
+    else
+    {
+      Panel_Command(data[i]);
+    }
+  }
+  return 0;
+}
+
+static uint8_t Panel_WriteAsync(uint8_t ctrl, const uint8_t *data, uint16_t len)
+{
+  Panel_Write(ctrl, data, len);
+  OLED_Port_TxDone(1);
+  return 0;
+}
+
+static void Panel_Recover(void)
+{
+}
+
+const OLED_Port OLED_PortLinux = {
+    Panel_Write,
+    Panel_WriteAsync,
+    Panel_Recover,
+};
+
+/**
+ * @brief 读取屏幕上(x,y)处的像素
+ * @note 屏幕坐标, 已去掉列偏移; 反色显示时返回的是实际亮灭
+ */
+uint8_t Panel_GetPixel(uint8_t x, uint8_t y)
+{
+  uint8_t bit = (panel.ram[y / 8][x + PANEL_OFFSET] >> (y % 8)) & 1;
+  return bit ^ panel.inverse;
+}
+
+/**
+ * @brief 把屏幕(128x64)保存为PBM图片
+ * @return 0:成功 -1:失败
+ */
+int Panel_WritePBM(const char *path)
+{
+  FILE *fp = fopen(path, "w");
+  if (fp == NULL)
+    return -1;
+  fprintf(fp, "P1\n%d %d\n", PANEL_COLUMN - 2 * PANEL_OFFSET, PANEL_ROW);
+  for (uint8_t y = 0; y < PANEL_ROW; y++)
+  {
+    for (uint8_t x = 0; x < PANEL_COLUMN - 2 * PANEL_OFFSET; x++)
+    {
+      fputc(Panel_GetPixel(x, y) ? '1' : '0', fp);
+    }
+    fputc('\n', fp);
+  }
+  fclose(fp);
+  return 0;
+}
+
+/**
+ * @brief 和PBM图片比较
+ * @return 不同的像素数, 文件不存在或格式不对时返回-1
+ */
+int Panel_ComparePBM(const char *path)
+{
+  FILE *fp = fopen(path, "r");
+  int w, h, ch, diff = 0;
+  if (fp == NULL)
+    return -1;
+  if (fscanf(fp, "P1 %d %d", &w, &h) != 2 || w != PANEL_COLUMN - 2 * PANEL_OFFSET || h != PANEL_ROW)
+  {
+    fclose(fp);
+    return -1;
+  }
+  for (int i = 0; i < w * h; i++)
+  {
+    do
+    {
+      ch = fgetc(fp);
+    } while (ch == ' ' || ch == '\n' || ch == '\r' || ch == '\t');
+    if (ch != '0' && ch != '1')
+    {
+      fclose(fp);
+      return -1;
+    }
+    if ((ch == '1') != Panel_GetPixel(i % w, i / w))
+      diff++;
+  }
+  fclose(fp);
+  return diff;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file oled_port_linux.h
+ * @brief OLED底层通信接口的PC实现: 虚拟SH1106面板
+ */
+#ifndef __OLED_PORT_LINUX_H__
+#define __OLED_PORT_LINUX_H__
+
+#include "oled_port.h"
+
+#define PANEL_COLUMN 132 // SH1106内部显存 132列
+#define PANEL_PAGE 8
+#define PANEL_ROW (PANEL_PAGE * 8)
+#define PANEL_OFFSET 2 // 屏幕第0列对应显存第2列
+
+typedef struct Panel {
+  uint8_t ram[PANEL_PAGE][PANEL_COLUMN];
+  uint8_t page, column;
+  uint8_t displayOn;
+  uint8_t contrast;
+  uint8_t inverse;     // A6/A7
+  uint8_t segRemap;    // A0/A1
+  uint8_t comReverse;  // C0/C8
+  uint8_t startLine;   // 40~7F
+  uint8_t pending;     // 正在等待参数的双字节指令, 0表示没有
+  uint32_t transactions; // I2C传输次数
+  uint32_t busBytes;     // 线上字节数 (器件地址 + 控制字节 + 数据)
+  uint32_t unknownCmds;  // 无法识别的指令数
+} Panel;
+
+extern Panel panel;
+extern const OLED_Port OLED_PortLinux;
+
+void Panel_Reset(void);
+void Panel_ResetCounters(void);
+uint8_t Panel_GetPixel(uint8_t x, uint8_t y);
+int Panel_WritePBM(const char *path);
+int Panel_ComparePBM(const char *path);
+
+#endif // __OLED_PORT_LINUX_H__
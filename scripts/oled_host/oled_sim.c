@@ -0,0 +1,448 @@
+/**
+ * @file oled_sim.c
+ * @brief OLED驱动的主机(PC)回归测试和基准测试
+ * @note 用虚拟SH1106面板(oled_port_linux.c)运行oled.c, 每个场景画一帧并经过
+ *       OLED_ShowFrame()完整走一遍I2C发送流程, 最后比较面板上的显示内容
+ *
+ * 用法:
+ *   oled_sim <目录>          把每个场景保存为 <目录>/<场景名>.pbm (生成基准图片)
+ *   oled_sim --check [目录]  和 <目录> (默认为仓库中的golden/) 中的基准图片比较,
+ *                            并检查填充图形是否盖住边框, 有错误时返回1
+ *   oled_sim --bench         打印每个场景的绘制耗时和I2C线上字节数
+ */
+#include "oled.h"
+#include "oled_port_linux.h"
+#include "glyph_cache.h"
+#include "font_pack.h"
+#include "crc32.h"
+#include "w25qxx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ROUNDS 20000
+#define SHAPE_ROUNDS 20000 // 边框检查的随机图形个数
+#define GOLDEN_DIR "golden"  // 仓库中的基准图片 (在本目录下运行)
+
+extern uint32_t W25Q_ReadCount;
+void W25Q_SetImage(const void *image, uint32_t len);
+
+static uint8_t canvas_buf[OLED_CANVAS_SIZE(40, 24)];
+static Canvas canvas = {40, 24, canvas_buf};
+
+static const uint8_t sprite[] = {0x3C, 0x42, 0xA5, 0x81, 0xA5, 0x99, 0x42, 0x3C,
+                                 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00};
+static const uint8_t spriteMask[] = {0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C,
+                                     0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00};
+static const Image spriteImg = {8, 10, sprite, spriteMask};
+
+// ========================== 场景 ==========================
+
+static void Scene_Pixels(void)
+{
+  for (uint8_t i = 0; i < 64; i++)
+  {
+    OLED_SetPixel(i * 2, i, OLED_COLOR_NORMAL);
+    OLED_SetPixel(127 - i, i, OLED_COLOR_NORMAL);
+  }
+}
+
+static void Scene_Lines(void)
+{
+  OLED_DrawLine(0, 0, 127, 63, OLED_COLOR_NORMAL);
+  OLED_DrawLine(0, 63, 127, 0, OLED_COLOR_NORMAL);
+  OLED_DrawLine(5, 10, 120, 10, OLED_COLOR_NORMAL);
+  OLED_DrawLine(64, 0, 64, 63, OLED_COLOR_NORMAL);
+  OLED_DrawLine(10, 50, 30, 5, OLED_COLOR_NORMAL);
+}
+
+static void Scene_Rectangles(void)
+{
+  OLED_DrawRectangle(2, 3, 40, 20, OLED_COLOR_NORMAL);
+  OLED_DrawFilledRectangle(50, 5, 30, 13, OLED_COLOR_NORMAL);
+  OLED_FillArea(90, 7, 30, 50, OLED_COLOR_NORMAL);
+  OLED_FillArea(95, 20, 20, 9, OLED_COLOR_REVERSED);
+  OLED_InvertArea(0, 30, 128, 11);
+  OLED_FillArea(-5, 50, 20, 30, OLED_COLOR_NORMAL); // 裁剪
+}
+
+static void Scene_Triangles(void)
+{
+  OLED_DrawTriangle(5, 60, 30, 2, 55, 45, OLED_COLOR_NORMAL);
+  OLED_DrawFilledTriangle(70, 60, 95, 2, 125, 45, OLED_COLOR_NORMAL);
+}
+
+static void Scene_Circles(void)
+{
+  OLED_DrawCircle(20, 32, 18, OLED_COLOR_NORMAL);
+  OLED_DrawFilledCircle(60, 32, 15, OLED_COLOR_NORMAL);
+  OLED_DrawEllipse(100, 20, 25, 10, OLED_COLOR_NORMAL);
+  OLED_DrawFilledEllipse(100, 48, 20, 8, OLED_COLOR_NORMAL);
+}
+
+static void Scene_Text(void)
+{
+  OLED_PrintASCIIString(0, 0, "8x6 Hello, OLED!", &afont8x6, OLED_COLOR_NORMAL);
+  OLED_PrintASCIIString(0, 9, "12x6 0123456789", &afont12x6, OLED_COLOR_NORMAL);
+  OLED_PrintASCIIString(0, 22, "16x8 ABCxyz", &afont16x8, OLED_COLOR_NORMAL);
+  OLED_PrintASCIIString(3, 39, "24x12", &afont24x12, OLED_COLOR_NORMAL);
+  OLED_PrintASCIIString(70, 44, "REV", &afont16x8, OLED_COLOR_REVERSED);
+}
+
+static void Scene_UTF8(void)
+{
+  OLED_PrintString(0, 0, "波特律动", &font16x16, OLED_COLOR_NORMAL);
+  OLED_PrintString(0, 20, "OLED 波特", &font16x16, OLED_COLOR_NORMAL);
+  OLED_PrintString(-4, 42, "律动 ok", &font16x16, OLED_COLOR_NORMAL); // 裁剪
+}
+
+static void Scene_GBK(void)
+{
+  // 主机上没有真正的字库, 点阵由地址算出; 这里检查的是取字地址和排版
+  OLED_ShowGBK(0, 0, "\xB2\xCB\xB5\xA5 Menu", 16, OLED_COLOR_NORMAL);       // 菜单
+  OLED_ShowGBK(0, 16, "\xCA\xB1\xBC\xE4\xA3\xBA" "12", 16, OLED_COLOR_NORMAL); // 时间：12
+  OLED_ShowGBK(0, 32, "\xB0\xA1\xBA\xCE\xD7\xF9", 16, OLED_COLOR_REVERSED);  // 啊何座
+  OLED_ShowGBK(100, 48, "\xD4\xD9\xBC\xFB", 16, OLED_COLOR_NORMAL);           // 再见 (换行)
+}
+
+static void Scene_GBKSizes(void)
+{
+  OLED_ShowGBK(0, 0, "\xB2\xCB\xB5\xA5 12px", 12, OLED_COLOR_NORMAL);  // 菜单
+  OLED_ShowGBK(0, 12, "\xB2\xCB\xB5\xA5 24", 24, OLED_COLOR_NORMAL);   // 菜单
+  OLED_ShowGBK(0, 36, "\xD4\xD9\xBC\xFB 32", 32, OLED_COLOR_REVERSED); // 再见
+  OLED_ShowGBK(112, 0, "\xB0\xA1", 20, OLED_COLOR_NORMAL);               // 没有20号, 用16号
+}
+
+static void Scene_Images(void)
+{
+  OLED_DrawImage(0, 0, &bilibiliImg, OLED_COLOR_NORMAL);
+  OLED_FillArea(60, 0, 68, 64, OLED_COLOR_NORMAL);
+  OLED_DrawImageOp(70, 5, &spriteImg, OLED_ROP_COPY);
+  OLED_DrawImageOp(85, 5, &spriteImg, OLED_ROP_XOR);
+  OLED_DrawImageOp(100, 5, &spriteImg, OLED_ROP_CLEAR);
+  OLED_SetBlockOp(70, 30, sprite, 8, 10, OLED_ROP_XOR);
+  OLED_SetBlock(85, 33, sprite, 8, 10, OLED_COLOR_REVERSED);
+  OLED_DrawImage(120, 50, &spriteImg, OLED_COLOR_NORMAL); // 裁剪
+}
+
+static void Scene_Canvas(void)
+{
+  OLED_SetTarget(&canvas);
+  OLED_ClearCanvas(&canvas);
+  OLED_DrawRectangle(0, 0, 39, 23, OLED_COLOR_NORMAL);
+  OLED_PrintASCIIString(4, 4, "CANVAS", &afont12x6, OLED_COLOR_NORMAL);
+  OLED_SetTarget(NULL);
+  OLED_DrawCanvas(3, 3, &canvas, OLED_ROP_COPY);
+  OLED_FillArea(50, 0, 78, 64, OLED_COLOR_NORMAL);
+  OLED_DrawCanvas(60, 30, &canvas, OLED_ROP_XOR);
+  OLED_DrawCanvas(100, 50, &canvas, OLED_ROP_OR); // 裁剪
+}
+
+static void Scene_Fullscreen(void)
+{
+  OLED_DrawImage(0, 0, &Genshin_Impact, OLED_COLOR_NORMAL);
+}
+
+typedef struct Scene {
+  const char *name;
+  void (*draw)(void);
+} Scene;
+
+static const Scene scenes[] = {
+    {"pixels", Scene_Pixels},
+    {"lines", Scene_Lines},
+    {"rectangles", Scene_Rectangles},
+    {"triangles", Scene_Triangles},
+    {"circles", Scene_Circles},
+    {"text", Scene_Text},
+    {"utf8", Scene_UTF8},
+    {"gbk", Scene_GBK},
+    {"gbk_sizes", Scene_GBKSizes},
+    {"images", Scene_Images},
+    {"canvas", Scene_Canvas},
+    {"fullscreen", Scene_Fullscreen},
+};
+#define SCENE_NUM (sizeof(scenes) / sizeof(scenes[0]))
+
+// ========================== 字库 ==========================
+
+static FontPackHeader pack;
+
+/**
+ * @brief 在虚拟Flash开头放一个字库头部 (12/16/24/32号, 排列与font_generater.py相同)
+ * @note 点阵数据仍由地址算出, 只用来检查各字号的取字地址和排版, 以及后台CRC校验
+ */
+static void Sim_InstallFontPack(void)
+{
+  static const uint8_t sizes[] = {12, 16, 24, 32};
+  uint32_t offset = FONT_PACK_DATA_OFFSET;
+  uint8_t buf[4096];
+
+  pack.magic = FONT_PACK_MAGIC;
+  pack.version = FONT_PACK_VERSION;
+  pack.glyphCount = (0xF7 - 0xA1 + 1) * 94;
+  pack.sizeCount = 4;
+  pack.rangeCount = 1;
+  pack.headerSize = sizeof(FontPackHeader);
+  for (int i = 0; i < 4; i++)
+  {
+    pack.sizes[i].size = sizes[i];
+    pack.sizes[i].w = sizes[i];
+    pack.sizes[i].glyphBytes = sizes[i] * ((sizes[i] + 7) / 8);
+    pack.sizes[i].offset = offset;
+    offset += pack.sizes[i].glyphBytes * pack.glyphCount;
+  }
+  pack.ranges[0].hiFirst = 0xA1;
+  pack.ranges[0].hiLast = 0xF7;
+  pack.ranges[0].loFirst = 0xA1;
+  pack.ranges[0].loLast = 0xFE;
+  for (uint32_t addr = FONT_PACK_DATA_OFFSET; addr < offset; addr += sizeof(buf))
+  {
+    uint32_t n = (offset - addr < sizeof(buf)) ? offset - addr : sizeof(buf);
+    W25Q_Read(buf, FONT_PACK_ADDR + addr, n);
+    pack.dataCrc = Crc32_Update(pack.dataCrc, buf, n);
+  }
+  pack.headerCrc = Crc32(&pack, sizeof(pack) - 4);
+  W25Q_SetImage(&pack, sizeof(pack));
+}
+
+// ========================== 填充图形 ==========================
+
+static uint8_t outline_buf[OLED_CANVAS_SIZE(128, 64)];
+static uint8_t filled_buf[OLED_CANVAS_SIZE(128, 64)];
+static Canvas outline = {128, 64, outline_buf};
+static Canvas filled = {128, 64, filled_buf};
+
+/**
+ * @brief 比较边框和填充图形
+ * @param exact 为1时每列的填充必须正好是边框在这一列上从最上到最下的一段 (三角形)
+ * @return 边框上没有被填充的点数, exact时加上多填的点数
+ */
+static int Shape_Compare(uint8_t exact)
+{
+  int bad = 0;
+  for (int x = 0; x < 128; x++)
+  {
+    int lo = 64, hi = -1;
+    for (int y = 0; y < 64; y++)
+    {
+      uint8_t o = (outline_buf[(y / 8) * 128 + x] >> (y % 8)) & 1;
+      if (o && y < lo)
+        lo = y;
+      if (o)
+        hi = y;
+    }
+    for (int y = 0; y < 64; y++)
+    {
+      uint8_t o = (outline_buf[(y / 8) * 128 + x] >> (y % 8)) & 1;
+      uint8_t f = (filled_buf[(y / 8) * 128 + x] >> (y % 8)) & 1;
+      if (o && !f)
+        bad++;
+      else if (exact && f != (y >= lo && y <= hi))
+        bad++;
+    }
+  }
+  return bad;
+}
+
+/**
+ * @brief 随机图形: 填充图形必须盖住同样参数画出的边框
+ * @return 有错误的图形个数
+ */
+static int Run_ShapeCheck(void)
+{
+  int bad, fail[3] = {0, 0, 0}, worst[3] = {0, 0, 0};
+  static const char *names[3] = {"triangle", "circle", "ellipse"};
+
+  srand(1);
+  for (int r = 0; r < SHAPE_ROUNDS; r++)
+  {
+    uint8_t v[6] = {rand() % 128, rand() % 64, rand() % 128, rand() % 64, rand() % 128, rand() % 64};
+    uint8_t a = 1 + rand() % 40, b = rand() % 40; // 半径为0时OLED_DrawCircle会在右上角多画一个点, 不检查
+
+    for (int k = 0; k < 3; k++)
+    {
+      OLED_ClearCanvas(&outline);
+      OLED_ClearCanvas(&filled);
+      OLED_SetTarget(&outline);
+      if (k == 0)
+        OLED_DrawTriangle(v[0], v[1], v[2], v[3], v[4], v[5], OLED_COLOR_NORMAL);
+      else if (k == 1)
+        OLED_DrawCircle(v[0], v[1], a, OLED_COLOR_NORMAL);
+      else
+        OLED_DrawEllipse(v[0], v[1], a, b, OLED_COLOR_NORMAL);
+      OLED_SetTarget(&filled);
+      if (k == 0)
+        OLED_DrawFilledTriangle(v[0], v[1], v[2], v[3], v[4], v[5], OLED_COLOR_NORMAL);
+      else if (k == 1)
+        OLED_DrawFilledCircle(v[0], v[1], a, OLED_COLOR_NORMAL);
+      else
+        OLED_DrawFilledEllipse(v[0], v[1], a, b, OLED_COLOR_NORMAL);
+      OLED_SetTarget(NULL);
+
+      bad = Shape_Compare(k == 0);
+      if (bad)
+      {
+        if (fail[k] == 0)
+          printf("%s (%u,%u %u,%u %u,%u r=%u,%u): %d pixels\n", names[k], v[0], v[1], v[2], v[3], v[4], v[5], a, b, bad);
+        fail[k]++;
+        if (bad > worst[k])
+          worst[k] = bad;
+      }
+    }
+  }
+  for (int k = 0; k < 3; k++)
+  {
+    if (fail[k])
+      printf("filled %-8s NOT COVERED in %d of %d (worst %d pixels)\n", names[k], fail[k], SHAPE_ROUNDS, worst[k]);
+    else
+      printf("filled %-8s ok (%d random shapes)\n", names[k], SHAPE_ROUNDS);
+  }
+  return fail[0] + fail[1] + fail[2];
+}
+
+// ========================== 运行 ==========================
+
+static void Scene_Show(const Scene *scene)
+{
+  OLED_NewFrame();
+  scene->draw();
+  OLED_ShowFrame();
+}
+
+static double NowNs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int Run_Dump(const char *dir)
+{
+  char path[256];
+  for (size_t i = 0; i < SCENE_NUM; i++)
+  {
+    Scene_Show(&scenes[i]);
+    snprintf(path, sizeof(path), "%s/%s.pbm", dir, scenes[i].name);
+    if (Panel_WritePBM(path) != 0)
+    {
+      printf("%s: cannot write\n", path);
+      return 1;
+    }
+    printf("%s\n", path);
+  }
+  return 0;
+}
+
+static int Run_Check(const char *dir)
+{
+  char path[256];
+  int diff, fail = 0;
+
+  if (Run_ShapeCheck())
+    fail = 1;
+  for (size_t i = 0; i < SCENE_NUM; i++)
+  {
+    Scene_Show(&scenes[i]);
+    snprintf(path, sizeof(path), "%s/%s.pbm", dir, scenes[i].name);
+    diff = Panel_ComparePBM(path);
+    if (diff < 0)
+      printf("%-12s MISSING (%s)\n", scenes[i].name, path);
+    else if (diff > 0)
+      printf("%-12s MISMATCH %d pixels\n", scenes[i].name, diff);
+    else
+      printf("%-12s ok\n", scenes[i].name);
+    if (diff != 0)
+      fail = 1;
+  }
+  if (panel.unknownCmds)
+    printf("note: %u commands not recognised by SH1106\n", (unsigned)panel.unknownCmds);
+  return fail;
+}
+
+static int Run_Bench(void)
+{
+  double t;
+  uint32_t bytes, transactions;
+
+  printf("%-12s %10s %12s %10s\n", "scene", "ns/frame", "bus bytes", "transfers");
+  for (size_t i = 0; i < SCENE_NUM; i++)
+  {
+    // 绘制耗时: 只计NewFrame + 绘制, 不含发送
+    t = NowNs();
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+    {
+      OLED_NewFrame();
+      scenes[i].draw();
+    }
+    t = (NowNs() - t) / BENCH_ROUNDS;
+
+    // 线上字节数: 从空白屏切换到该场景(增量刷新)
+    OLED_NewFrame();
+    OLED_ShowFrame();
+    Panel_ResetCounters();
+    Scene_Show(&scenes[i]);
+    bytes = panel.busBytes;
+    transactions = panel.transactions;
+
+    printf("%-12s %10.0f %12u %10u\n", scenes[i].name, t, (unsigned)bytes, (unsigned)transactions);
+  }
+
+  // 汉字缓存: 稳定界面上每帧不应再读外部Flash
+  uint32_t hits, misses, reads = W25Q_ReadCount;
+  for (int r = 0; r < 100; r++)
+  {
+    OLED_NewFrame();
+    Scene_GBK();
+  }
+  GlyphCache_GetStats(&hits, &misses);
+  printf("glyph cache: %u hits, %u misses in total; %u flash reads in 100 more gbk frames\n",
+         (unsigned)hits, (unsigned)misses, (unsigned)(W25Q_ReadCount - reads));
+
+  // 冷启动(缓存为空)时一帧的Flash读取次数: 每个缺的字读一次
+  GlyphCache_Clear();
+  reads = W25Q_ReadCount;
+  OLED_NewFrame();
+  Scene_GBK();
+  GlyphCache_GetStats(&hits, &misses);
+  printf("glyph cache cold gbk frame: %u glyphs in %u flash reads\n",
+         (unsigned)misses, (unsigned)(W25Q_ReadCount - reads));
+
+  // 同一帧再发一次: 没有变化时应该不占用总线
+  Panel_ResetCounters();
+  Scene_Show(&scenes[SCENE_NUM - 1]);
+  printf("%-12s %10s %12u %10u\n", "unchanged", "-", (unsigned)panel.busBytes, (unsigned)panel.transactions);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  Panel_Reset();
+  Sim_InstallFontPack();
+  if (!FontPack_Init())
+  {
+    printf("font pack header rejected\n");
+    return 1;
+  }
+  while (FontPack_VerifyStep() == FONT_PACK_VERIFY_RUNNING)
+    ;
+  if (FontPack_GetVerifyState() != FONT_PACK_VERIFY_OK)
+  {
+    printf("font pack data crc mismatch\n");
+    return 1;
+  }
+  OLED_SetPort(&OLED_PortLinux);
+  OLED_Init();
+  printf("init: %u bus bytes in %u transfers (full frame included)\n",
+         (unsigned)panel.busBytes, (unsigned)panel.transactions);
+
+  if (argc == 2 && strcmp(argv[1], "--bench") == 0)
+    return Run_Bench();
+  if (argc >= 2 && argc <= 3 && strcmp(argv[1], "--check") == 0)
+    return Run_Check(argc == 3 ? argv[2] : GOLDEN_DIR);
+  if (argc == 2 && argv[1][0] != '-')
+    return Run_Dump(argv[1]);
+  printf("usage: oled_sim <dir> | oled_sim --check [dir] | oled_sim --bench\n");
+  return 2;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file main.h
+ * @brief 主机(PC)编译oled.c时使用的HAL替身
+ * @note 只声明oled.c用到的函数, 实现在hal_stub.c中; I2C由oled_port_linux.c的虚拟面板代替
+ */
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+#endif /* __MAIN_H */
@@ -0,0 +1,18 @@
+/**
+ * @file spi.h
+ * @brief 主机(PC)编译时使用的SPI替身
+ * @note 让 Modules/w25qxx.h 可以直接包含; W25Q_Read 的替身实现在hal_stub.c中
+ */
+#ifndef __SPI_H__
+#define __SPI_H__
+
+#include "main.h"
+
+typedef struct
+{
+  uint32_t dummy;
+} SPI_HandleTypeDef;
+
+extern SPI_HandleTypeDef hspi1;
+
+#endif /* __SPI_H__ */
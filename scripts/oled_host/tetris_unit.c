@@ -0,0 +1,55 @@
+/**
+ * @file tetris_unit.c
+ * @brief 把Applications/game.c编进bench_tetris的包装
+ * @note 直接#include真正的game.c, 以便设置其中的静态变量(棋盘、分数、当前方块);
+ *       定义TETRIS_ROTATE_PER_PIXEL再编译一次得到逐像素画字的版本,
+ *       这时所有全局函数加上px_前缀, 两份可以链接进同一个程序
+ */
+#include <stdio.h> // game.c用到sprintf, 在Keil中不包含也能编译
+
+#ifdef TETRIS_ROTATE_PER_PIXEL
+#define DrawPixel_Rotated90 px_DrawPixel_Rotated90
+#define DrawChar_Rotated px_DrawChar_Rotated
+#define DrawString_Rotated px_DrawString_Rotated
+#define DrawRotatedBlock px_DrawRotatedBlock
+#define GetRotatedPoint px_GetRotatedPoint
+#define CheckCollision px_CheckCollision
+#define LockBlock px_LockBlock
+#define ClearLines px_ClearLines
+#define SpawnBlock px_SpawnBlock
+#define DrawTetris px_DrawTetris
+#define DrawDifficultyMenu px_DrawDifficultyMenu
+#define App_Tetris_Loop px_App_Tetris_Loop
+#define Tetris_SetState px_Tetris_SetState
+#define Tetris_Draw px_Tetris_Draw
+#endif
+
+#include "../../Applications/game.c"
+
+/**
+ * @brief 由种子生成一个确定的游戏局面
+ * @param seed 种子 两个版本用同一个种子得到同一个局面
+ * @param over 1: 游戏结束画面 0: 游戏中
+ */
+void Tetris_SetState(uint32_t seed, uint8_t over)
+{
+  for (uint8_t y = 0; y < T_ROWS; y++)
+    for (uint8_t x = 0; x < T_COLS; x++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      // 越往下越满, 和实际游戏中的局面接近
+      board[y][x] = ((seed >> 16) % T_ROWS) < y;
+    }
+  seed = seed * 1103515245u + 12345u;
+  t_score = (seed >> 8) % 1000000;
+  cur_shape_idx = (seed >> 4) % 7;
+  cur_rot = seed % 4;
+  cur_x = T_COLS / 2 - 2;
+  cur_y = 1;
+  t_state = over ? GAME_OVER : GAME_PLAY;
+}
+
+void Tetris_Draw(void)
+{
+  DrawTetris();
+}
@@ -11,50 +11,32 @@
  * [0]   : ִȫƬ (Erase Chip) 
  *         -> ע⣺ǵһʹǰģʱԼ 20-40롣
  * 
- * [1-8] : ¼ӦֿƬ (Part 1 ~ Part 8)
+ * [1-N] : ¼ӦֿƬ (Part 1 ~ Part N, N  font_generater.py , ־е FONT_PART_COUNT)
  *         -> ÿ޸ĺ󣬵룬ȻصƬ
  */
 #define BURN_STEP 7
 //#define each_size 261696
 // ================== Զ߼ ==================
-// ĴԶ BURN_STEP ѡҪļ
-// ͳһӳΪ CURRENT_ARRAY
+// ĴԶ BURN_STEP  font_part_<BURN_STEP>.h
+//  Font_Part_<BURN_STEP> ͳһӳΪ CURRENT_ARRAY
+// ־ֿС仯, ﲻг; BURN_STEP ־ʱҲļ, 뱨
 // ================================================
 
-#if BURN_STEP == 1
-    #include "font_part_1.h"       // 1
-    #define CURRENT_ARRAY Font_Part_1
+#define BURN_STR_(x)    #x
+#define BURN_STR(x)     BURN_STR_(x)
+#define BURN_CAT_(a, b) a##b
+#define BURN_CAT(a, b)  BURN_CAT_(a, b)
 
-#elif BURN_STEP == 2
-    #include "font_part_2.h"       // 2
-    #define CURRENT_ARRAY Font_Part_2
-
-#elif BURN_STEP == 3
-    #include "font_part_3.h"       // 3
-    #define CURRENT_ARRAY Font_Part_3
-
-#elif BURN_STEP == 4
-    #include "font_part_4.h"       // 4
-    #define CURRENT_ARRAY Font_Part_4
-
-#elif BURN_STEP == 5
-    #include "font_part_5.h"       // 5
-    #define CURRENT_ARRAY Font_Part_5
-
-#elif BURN_STEP == 6
-    #include "font_part_6.h"       // 6
-    #define CURRENT_ARRAY Font_Part_6
-
-#elif BURN_STEP == 7
-    #include "font_part_7.h"       // 7
-    #define CURRENT_ARRAY Font_Part_7
-
-#elif BURN_STEP == 0
+#if BURN_STEP == 0
     // ģʽ²Ҫ飬ֹ
     #define CURRENT_ARRAY  0 
 
+#elif BURN_STEP > 0
+    #include BURN_STR(BURN_CAT(font_part_, BURN_STEP).h)  // BURN_STEP
+    #define CURRENT_ARRAY BURN_CAT(Font_Part_, BURN_STEP)
+
 #else
-    #error "[burn_data.h] ô: BURN_STEP  0  8 ֮!"
+    #error "[burn_data.h] ô: BURN_STEP  0 !"
 #endif
 
 #endif // __BURN_DATA_H__
\ No newline at end of file
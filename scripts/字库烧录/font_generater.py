@@ -1,4 +1,6 @@
 import os
+import struct
+import zlib
 from PIL import Image, ImageFont, ImageDraw
 from tqdm import tqdm
 
@@ -7,30 +9,62 @@ from tqdm import tqdm
 # 字体路径
 FONT_PATH = os.path.expandvars(r'%WINDIR%\Fonts\simsun.ttc')
 
-# 生成的字号列表
-FONT_SIZES = [16]
+# 生成的字号列表 (最多4个)
+FONT_SIZES = [12, 16, 24, 32]
 
-# 输出文件分割数量
-SPLIT_PARTS = 7
+# 每个分卷的最大字节数 (256的整数倍, 每个分卷由 font_write.c 烧录一次)
+# 分卷和烧录程序一起下载到 STM32F103C8 (64KB Flash), 必须给程序留出空间;
+# 旧版 37386 字节的分卷可以正常烧录, 这里取 36KB. 分卷数量由字库大小算出 (4个字号约2MB, 57卷)
+PART_MAX_BYTES = 36 * 1024
 
 # 输出目录
 OUTPUT_DIR = "D:\Desktop"
 
 # ===========================================
 
+# ================= 字库格式 =================
+# 必须与 Modules/font_pack.h 保持一致
+#
+# PACK_ADDR + 0    : 头部 (小端, 不足256字节的部分填0xFF)
+# PACK_ADDR + 256  : 各字号的点阵数据, 依次排列
+#
+# 头部: magic, version, glyphCount, sizeCount, rangeCount, headerSize,
+#       sizes[4]  (size, w, glyphBytes, offset),
+#       ranges[4] (hiFirst, hiLast, loFirst, loLast, glyphBase, 0),
+#       dataCrc, headerCrc (CRC32, 与zlib.crc32相同)
+
+PACK_ADDR = 0x000000
+PACK_MAGIC = 0x4B504E46  # "FNPK"
+PACK_VERSION = 1
+PACK_DATA_OFFSET = 256
+PACK_MAX_SIZES = 4
+PACK_MAX_RANGES = 4
+
+HEADER_FMT = "<IHHBBH"
+SIZE_FMT = "<BBHI"
+RANGE_FMT = "<BBBBHH"
+HEADER_SIZE = (struct.calcsize(HEADER_FMT) + PACK_MAX_SIZES * struct.calcsize(SIZE_FMT)
+               + PACK_MAX_RANGES * struct.calcsize(RANGE_FMT) + 8)
+
+# GB2312 区位: 高字节 0xA1~0xF7, 低字节 0xA1~0xFE (空位也占一个字)
+RANGES = [(0xA1, 0xF7, 0xA1, 0xFE)]
+
+# ===========================================
+
 def get_gb2312_chars_info():
-    """生成 GB2312 所有编码对应的字符信息"""
+    """按编码范围表的顺序生成所有字符信息"""
     # 返回列表: [(区位码字符串, 字符), ...]
     chars_info = []
-    for high in range(0xA1, 0xF8): 
-        for low in range(0xA1, 0xFF):
-            val = bytes([high, low])
-            code_str = f"0x{high:02X}{low:02X}"
-            try:
-                char = val.decode('gb2312')
-                chars_info.append((code_str, char))
-            except:
-                chars_info.append((code_str, "  ")) # 空位
+    for (hi_first, hi_last, lo_first, lo_last) in RANGES:
+        for high in range(hi_first, hi_last + 1):
+            for low in range(lo_first, lo_last + 1):
+                val = bytes([high, low])
+                code_str = f"0x{high:02X}{low:02X}"
+                try:
+                    char = val.decode('gb2312')
+                    chars_info.append((code_str, char))
+                except:
+                    chars_info.append((code_str, "  ")) # 空位
     return chars_info
 
 def get_font_bitmap(char, size, font):
@@ -62,38 +96,55 @@ def get_font_bitmap(char, size, font):
     
     return buffer
 
+def build_header(size_entries, glyph_count, data):
+    """生成字库头部 (填充到 PACK_DATA_OFFSET 字节)"""
+    head = struct.pack(HEADER_FMT, PACK_MAGIC, PACK_VERSION, glyph_count,
+                       len(size_entries), len(RANGES), HEADER_SIZE)
+    for i in range(PACK_MAX_SIZES):
+        if i < len(size_entries):
+            head += struct.pack(SIZE_FMT, *size_entries[i])
+        else:
+            head += struct.pack(SIZE_FMT, 0, 0, 0, 0)
+    glyph_base = 0
+    for i in range(PACK_MAX_RANGES):
+        if i < len(RANGES):
+            hi_first, hi_last, lo_first, lo_last = RANGES[i]
+            head += struct.pack(RANGE_FMT, hi_first, hi_last, lo_first, lo_last, glyph_base, 0)
+            glyph_base += (hi_last - hi_first + 1) * (lo_last - lo_first + 1)
+        else:
+            head += struct.pack(RANGE_FMT, 0, 0, 0, 0, 0, 0)
+    head += struct.pack("<I", zlib.crc32(data))
+    head += struct.pack("<I", zlib.crc32(head))
+    assert len(head) == HEADER_SIZE
+    return head + b"\xFF" * (PACK_DATA_OFFSET - len(head))
+
+def write_part(index, count, addr, chunk):
+    """生成一个分卷的C头文件, 由 font_write.c 烧录到 FONT_PART_ADDR"""
+    path = os.path.join(OUTPUT_DIR, f"font_part_{index}.h")
+    with open(path, "w", encoding="gb2312") as f:
+        f.write(f'#include "stdint.h"\n')
+        f.write(f"// Part {index} (Total {count})\n")
+        f.write(f"#define FONT_PART_ADDR 0x{addr:08X}\n")
+        f.write(f"#define FONT_PART_COUNT {count}\n")
+        f.write(f"static const uint8_t Font_Part_{index}[] = {{\n")
+        for i in range(0, len(chunk), 32):
+            hex_str = ", ".join([f"0x{b:02X}" for b in chunk[i:i + 32]])
+            f.write(f"    {hex_str}, // 0x{addr + i:08X}\n")
+        f.write("};\n")
+
 def main():
     if not os.path.exists(OUTPUT_DIR):
         os.makedirs(OUTPUT_DIR)
+    assert len(FONT_SIZES) <= PACK_MAX_SIZES and len(RANGES) <= PACK_MAX_RANGES
 
     print("正在初始化字符集 (GB2312)...")
     chars_info_list = get_gb2312_chars_info()
     total_chars = len(chars_info_list)
     print(f"字符总数: {total_chars}")
 
-    # 1. 预先计算总字节数，以便均匀分割
-    print("正在计算总数据量...")
-    total_bytes_needed = 0
-    for size in FONT_SIZES:
-        bytes_per_char = ((size + 7) // 8) * size
-        total_bytes_needed += bytes_per_char * total_chars
-    
-    bytes_per_part = (total_bytes_needed + SPLIT_PARTS - 1) // SPLIT_PARTS
-    print(f"预计总大小: {total_bytes_needed} 字节")
-    print(f"每个文件约: {bytes_per_part} 字节")
-
-    # 2. 开始生成
-    current_part = 1
-    current_part_bytes = 0
-    current_offset = 0
-    offset_map = {} # 记录每个字号的物理起始地址
-
-    # 打开第一个文件
-    f = open(os.path.join(OUTPUT_DIR, f"font_part_{current_part}.h"), "w", encoding="gb2312")
-    f.write(f'#include "stdint.h"\n')
-    f.write(f"// Part {current_part} (Total 8)\n")
-    f.write(f"static const uint8_t Font_Part_{current_part}[] = {{\n")
-
+    # 1. 依次生成各字号的点阵数据
+    data = bytearray()
+    size_entries = []
     for size in FONT_SIZES:
         print(f"\n正在处理 {size}x{size} 字体...")
         try:
@@ -102,56 +153,35 @@ def main():
             print("字体加载失败")
             return
 
-        # 记录地址映射
-        offset_map[size] = current_offset
         bytes_per_char = ((size + 7) // 8) * size
-
-        # 遍历所有汉字
+        size_entries.append((size, size, bytes_per_char, PACK_DATA_OFFSET + len(data)))
         for (code_str, char) in tqdm(chars_info_list):
-            
-            # 获取字模数据
-            bitmap = get_font_bitmap(char, size, font)
-            
-            # 格式化为 Hex 字符串: "0x00, 0x01, ..."
-            hex_str = ", ".join([f"0x{b:02X}" for b in bitmap])
-            
-            # 构造这一行的文本
-            # 格式: 数据 , // [字] 编码
-            line_str = f"    {hex_str}, // {size}px [{char}] {code_str}\n"
-            
-            # 检查是否需要切换文件
-            # 注意：我们尽量不要在同一个汉字的数据中间切断文件，那样很难看
-            # 所以我们在写入一个完整汉字前检查大小
-            if current_part_bytes + len(bitmap) > bytes_per_part and current_part < SPLIT_PARTS:
-                # 结束当前文件
-                f.write("};\n")
-                f.close()
-                print(f"已生成 Part {current_part}, 切换到下一个文件...")
-                
-                # 开启新文件
-                current_part += 1
-                current_part_bytes = 0
-                f = open(os.path.join(OUTPUT_DIR, f"font_part_{current_part}.h"), "w", encoding="gb2312")
-                f.write(f'#include "stdint.h"\n')
-                f.write(f"// Part {current_part} (Total 8)\n")
-                f.write(f"static const uint8_t Font_Part_{current_part}[] = {{\n")
-            
-            # 写入数据
-            f.write(line_str)
-            
-            # 更新计数器
-            current_part_bytes += len(bitmap)
-            current_offset += len(bitmap)
-
-    # 收尾
-    f.write("};\n")
-    f.close()
-    
+            data += get_font_bitmap(char, size, font)
+
+    # 2. 加上头部, 得到完整的字库
+    pack = build_header(size_entries, total_chars, bytes(data)) + data
+    with open(os.path.join(OUTPUT_DIR, "font_pack.bin"), "wb") as f:
+        f.write(pack)
+
+    # 3. 分卷: 卷数由 PART_MAX_BYTES 算出, 每卷按256字节(Flash页)对齐切分, 依次紧接着烧录, 中间没有空隙
+    assert PART_MAX_BYTES % 256 == 0
+    part_count = (len(pack) + PART_MAX_BYTES - 1) // PART_MAX_BYTES
+    bytes_per_part = (len(pack) + part_count - 1) // part_count
+    bytes_per_part = (bytes_per_part + 255) // 256 * 256
+    part_count = (len(pack) + bytes_per_part - 1) // bytes_per_part
+    for i in range(part_count):
+        start = i * bytes_per_part
+        chunk = pack[start:start + bytes_per_part]
+        write_part(i + 1, part_count, PACK_ADDR + start, chunk)
+        print(f"已生成 Part {i + 1}/{part_count}: 0x{PACK_ADDR + start:08X}, {len(chunk)} 字节")
+
     print("\n================ 生成完成 ================")
+    print(f"字库总大小: {len(pack)} 字节, 数据CRC32: 0x{zlib.crc32(bytes(data)):08X}")
+    print(f"共 {part_count} 个分卷, 在 burn_data.h 中依次把 BURN_STEP 设为 0 (擦除), 1 ~ {part_count}")
     print("各字号在 Flash 中的起始绝对地址 (Hex):")
-    for size, addr in offset_map.items():
-        print(f"  {size}x{size}: 0x{addr:08X}")
+    for (size, w, bytes_per_char, offset) in size_entries:
+        print(f"  {size}x{size}: 0x{PACK_ADDR + offset:08X}")
     print("==========================================")
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    main()
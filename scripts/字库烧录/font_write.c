@@ -31,14 +31,24 @@ void write_process (void)
         OLED_PrintASCIIString(0, 32, "CHIP ERASED!",     &afont16x8, 1);
         OLED_ShowFrame();
 
-    #elif BURN_STEP >= 1 && BURN_STEP <= 8
-        // ---------------- [ģʽ 1-8: ¼] ----------------
+    #elif BURN_STEP >= 1
+        // ---------------- [ģʽ 1-N: ¼] ----------------
         
         // 1. 㱾дʼַ
+        // °ɽűÿ־д˵ַ(־, ͷֿͷ);
+        // ɰ־ûеַ,  PART_SIZE д
+    #ifdef FONT_PART_ADDR
+        uint32_t write_addr = FONT_PART_ADDR;
+    #else
         uint32_t write_addr = (BURN_STEP - 1) * PART_SIZE;
+    #endif
         
         // 2.  OLED ʾǰڸʲô
+    #ifdef FONT_PART_COUNT
+        sprintf(lcd_buf, "Burning %d/%d", BURN_STEP, FONT_PART_COUNT);
+    #else
         sprintf(lcd_buf, "Burning Part %d", BURN_STEP);
+    #endif
         OLED_PrintASCIIString(0, 0, lcd_buf, &afont16x8, 1);
         
         sprintf(lcd_buf, "Addr: 0x%X", write_addr); // ʾʮƵַ